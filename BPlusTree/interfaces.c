@@ -0,0 +1,915 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+#if defined(__GNUC__) && defined(__SSE2__) && defined(TYPE_INT) && (BPT_KEYS % 4 == 0)
+# define BPT_SIMD
+# include <emmintrin.h>
+#endif
+
+/* --------------------------------------------
+ *
+ *                  B+TREE
+ *
+ * Foundation used:   Node (array of keys)
+ *
+ * Every key lives in a leaf; internal nodes only hold separators:
+ * child 'i' holds the keys k with keys[i - 1] <= k < keys[i].
+ * Leaves are linked in key order for range scans.
+ *
+ * --------------------------------------------
+ */
+
+void initBPT(struct BPTree* tree)
+{
+  /*  Description:
+   *    Function initializes a B+tree structure using a pointer to its memory address.
+   *    The function does not allocate additional memory upon initialization.
+   *
+   *  Parameters:
+   *    [struct] (BPTree*) tree: A pointer to the B+tree.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *
+   *  Post-conditions:
+   *    - The B+tree is initialized: the size is 0, and the root points to NULL.
+   */
+
+  assert(tree);
+
+  tree->size = 0;
+  tree->root = NULL;
+  tree->height = 0;
+
+  tree->slabs = NULL;
+  tree->freeNodes[0] = NULL;
+  tree->freeNodes[1] = NULL;
+  tree->unused = NULL;
+  tree->unusedLines = 0;
+}
+
+void freeBPT(struct BPTree* tree)
+{
+  /*  Description:
+   *    Function frees the node pool's slabs, which hold every node.
+   *
+   *  Parameters:
+   *    [struct] (BPTree*) tree: A pointer to the B+tree.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The B+tree was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The B+tree's memory is freed, and the B+tree is left empty.
+   */
+
+  struct BPTSlab* slab;
+
+  assert(tree);
+
+  while (tree->slabs)
+  {
+    slab = tree->slabs;
+    tree->slabs = slab->next;
+
+    free(slab);
+  }
+
+  initBPT(tree);
+}
+
+int containsBPT(struct BPTree* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log(n)), with one node (one cache line of keys) visited per level.
+   *    Function descends to the leaf that would hold the value, and searches it.
+   *
+   *  Parameters:
+   *    [struct] (BPTree*) tree: A pointer to the B+tree.
+   *    [TYPE]              val: The value to search for.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The B+tree is correctly linked.
+   *
+   *  Post-conditions:
+   *    - The function returns True (1) if the value is contained, or False (0) if not.
+   */
+
+  struct BPTNode* leaf;
+  int pos;
+
+  assert(tree);
+
+  if ( isEmptyBPT(tree) )
+    return 0;
+
+  leaf = _findLeaf(tree, val);
+  pos = _lowerBound(leaf, val);
+
+  if ( _matchKey(leaf, pos, val) )
+  {
+    return 1;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+int addBPT(struct BPTree* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log(n)).
+   *    Function descends to the leaf that should hold the value, recording the path, and inserts it
+   *    in order. A full node is split in two halves before the insertion; the split adds a separator
+   *    to the parent, which may split in turn, up to a new root.
+   *    The B+tree is a set: a value that is already contained is not added again.
+   *
+   *  Parameters:
+   *    [struct] (BPTree*) tree: A pointer to the B+tree.
+   *    [TYPE]              val: The value to insert.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was added, False if it was already contained.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The B+tree is correctly linked.
+   *
+   *  Post-conditions:
+   *    - The value is contained, and every node other than the root holds between
+   *      BPT_MIN and BPT_KEYS keys.
+   */
+
+  struct BPTNode* path[BPT_MAX_HEIGHT];
+  int index[BPT_MAX_HEIGHT];
+  struct BPTNode* node;
+  struct BPTNode* right;
+  TYPE sep;
+  int depth = 0;
+  int pos;
+
+  assert(tree);
+
+  if (tree->root == NULL)
+  {
+    tree->root = _newNode(tree, 1);
+  }
+
+  node = tree->root;
+
+  while (depth < tree->height)
+  {
+    path[depth] = node;
+    index[depth] = _childIndex(node, val);
+
+    node = node->child[ index[depth++] ];
+  }
+
+  pos = _lowerBound(node, val);
+
+  if ( _matchKey(node, pos, val) )
+    return 0;
+
+  right = NULL;
+
+  if (node->count == BPT_KEYS)
+  {
+    right = _splitNode(tree, node, &sep);
+
+    if (pos > node->count)
+    {
+      _insertKey(right, pos - node->count, val, NULL);
+    }
+    else
+    {
+      _insertKey(node, pos, val, NULL);
+    }
+
+    sep = right->keys[0];
+  }
+  else
+  {
+    _insertKey(node, pos, val, NULL);
+  }
+
+  /* Each split hands a separator and a new right sibling to the parent */
+  while (right && depth > 0)
+  {
+    node = path[--depth];
+    pos = index[depth];
+
+    if (node->count == BPT_KEYS)
+    {
+      struct BPTNode* upper;
+      TYPE up;
+
+      upper = _splitNode(tree, node, &up);
+
+      if (pos > node->count)
+      {
+        _insertKey(upper, pos - node->count - 1, sep, right);
+      }
+      else
+      {
+        _insertKey(node, pos, sep, right);
+      }
+
+      sep = up;
+      right = upper;
+    }
+    else
+    {
+      _insertKey(node, pos, sep, right);
+
+      right = NULL;
+    }
+
+  }
+
+  if (right)
+  {
+    /* The root was split: the tree grows by one level */
+    node = _newNode(tree, 0);
+
+    node->keys[0] = sep;
+    node->child[0] = tree->root;
+    node->child[1] = right;
+    node->count = 1;
+
+    tree->root = node;
+    tree->height++;
+  }
+
+  tree->size++;
+
+  return 1;
+}
+
+int removeBPT(struct BPTree* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log(n)).
+   *    Function descends to the leaf holding the value, recording the path, and removes it.
+   *    A node left with fewer than BPT_MIN keys borrows one from a sibling that can spare it,
+   *    or else is merged with a sibling; a merge takes a separator from the parent, which may
+   *    underflow in turn. A root left without keys is replaced by its only child.
+   *
+   *  Parameters:
+   *    [struct] (BPTree*) tree: A pointer to the B+tree.
+   *    [TYPE]              val: The value to remove.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was removed, False if it was not contained.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The B+tree is correctly linked.
+   *
+   *  Post-conditions:
+   *    - The value is not contained, and every node other than the root holds between
+   *      BPT_MIN and BPT_KEYS keys.
+   */
+
+  struct BPTNode* path[BPT_MAX_HEIGHT];
+  int index[BPT_MAX_HEIGHT];
+  struct BPTNode* node;
+  struct BPTNode* parent;
+  struct BPTNode* left;
+  struct BPTNode* right;
+  int depth = 0;
+  int pos;
+
+  assert(tree);
+
+  if ( isEmptyBPT(tree) )
+    return 0;
+
+  node = tree->root;
+
+  while (depth < tree->height)
+  {
+    path[depth] = node;
+    index[depth] = _childIndex(node, val);
+
+    node = node->child[ index[depth++] ];
+  }
+
+  pos = _lowerBound(node, val);
+
+  if ( !_matchKey(node, pos, val) )
+    return 0;
+
+  _removeKey(node, pos);
+
+  tree->size--;
+
+  while ( (depth > 0) && (node->count < BPT_MIN) )
+  {
+    parent = path[--depth];
+    pos = index[depth];
+
+    left = (pos > 0) ? parent->child[pos - 1] : NULL;
+    right = (pos < parent->count) ? parent->child[pos + 1] : NULL;
+
+    if (left && left->count > BPT_MIN)
+    {
+      _borrowLeft(parent, pos);
+    }
+    else if (right && right->count > BPT_MIN)
+    {
+      _borrowRight(parent, pos);
+    }
+    else if (left)
+    {
+      _mergeChildren(tree, parent, pos - 1);
+    }
+    else
+    {
+      _mergeChildren(tree, parent, pos);
+    }
+
+    node = parent;
+  }
+
+  node = tree->root;
+
+  if (node->count == 0)
+  {
+
+    if (node->leaf)
+    {
+      tree->root = NULL;
+    }
+    else
+    {
+      tree->root = node->child[0];
+      tree->height--;
+    }
+
+    _freeNode(tree, node);
+  }
+
+  return 1;
+}
+
+int rangeBPT(struct BPTree* tree, TYPE lo, TYPE hi, TYPE* out, int max)
+{
+  /*  Description:
+   *    Complexity O(log(n) + k), for k values in range.
+   *    Function descends once to the leaf holding 'lo', then follows the leaf links in key order,
+   *    copying values until one exceeds 'hi' or 'max' values are copied.
+   *
+   *  Parameters:
+   *    [struct] (BPTree*) tree: A pointer to the B+tree.
+   *    [TYPE]              lo : The lowest value in range.
+   *    [TYPE]              hi : The highest value in range.
+   *    [TYPE]   (TYPE*)    out: The array the values are copied to, in order.
+   *    [int]               max: The capacity of 'out'.
+   *
+   *  Returns:
+   *    [int]     The number of values copied.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - Pointer 'out' points to an array of at least 'max' values.
+   *
+   *  Post-conditions:
+   *    - The values v with lo <= v <= hi are copied to 'out', in order, up to 'max' of them.
+   */
+
+  struct BPTNode* leaf;
+  int pos;
+  int n = 0;
+
+  assert(tree);
+
+  if ( isEmptyBPT(tree) )
+    return 0;
+
+  leaf = _findLeaf(tree, lo);
+  pos = _lowerBound(leaf, lo);
+
+  while (leaf && n < max)
+  {
+
+    if (pos == leaf->count)
+    {
+      leaf = leaf->next;
+      pos = 0;
+    }
+    else if ( LT(hi, leaf->keys[pos]) )
+    {
+      break;
+    }
+    else
+    {
+      out[n++] = leaf->keys[pos++];
+    }
+
+  }
+
+  return n;
+}
+
+void printBPT(struct BPTree* tree)
+{
+  /*  Description:
+   *    Function walks the linked leaves from the leftmost one, and prints the values in-order.
+   *
+   *  Parameters:
+   *    [struct] (BPTree*) tree: A pointer to the B+tree.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The B+tree is correctly linked.
+   *
+   *  Post-conditions:
+   *    - The function prints the B+tree in-order to stdout.
+   */
+
+  struct BPTNode* node;
+  int i;
+
+  assert(tree);
+
+  node = tree->root;
+
+  while (node && !node->leaf)
+    node = node->child[0];
+
+  while (node)
+  {
+
+    for (i = 0; i < node->count; i++)
+      printf("Key with value: { %d }\n", node->keys[i]);
+
+    node = node->next;
+  }
+
+}
+
+int isEmptyBPT(struct BPTree* tree)
+{
+  /*  Description:
+   *    Function checks the B+tree's size and returns true or false.
+   *
+   *  Parameters:
+   *    [struct]  (BPTree*)  tree: A pointer to the B+tree.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True or False, if the structure is empty or not.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The B+tree was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - True (1) or False (0) is returned.
+   */
+
+  assert(tree);
+
+  if (tree->size == 0)
+  {
+    return 1;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+void _addSlab(struct BPTree* tree)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Allocates a slab of BPT_SLAB_LINES cache lines, aligned to BPT_LINE, and makes it the pool's
+   *    newest slab, with every line unused. Lines left unused in the previous slab are not reclaimed.
+   */
+
+  struct BPTSlab* slab;
+  unsigned long first;
+
+  slab = (struct BPTSlab*) malloc( sizeof(struct BPTSlab) + (BPT_LINE - 1) + (unsigned long) BPT_LINE * BPT_SLAB_LINES );
+
+  assert(slab);
+
+  first = ( (unsigned long) (slab + 1) + (BPT_LINE - 1) ) & ~((unsigned long) BPT_LINE - 1);
+
+  slab->next = tree->slabs;
+
+  tree->slabs = slab;
+  tree->unused = (char*) first;
+  tree->unusedLines = BPT_SLAB_LINES;
+}
+
+struct BPTNode* _newNode(struct BPTree* tree, int leaf)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Takes an empty node from the pool: the most recently released one of the same kind if any,
+   *    else the next unused lines of the newest slab. Nodes start on a BPT_LINE boundary and carry
+   *    no allocator header, so a node's keys are exactly its first line and never straddle two.
+   *    A leaf is carved without the trailing 'child' array.
+   *
+   *  Post-conditions:
+   *    - The new node is returned, with no keys and every key slot padded.
+   */
+
+  struct BPTNode* node;
+  int lines;
+  int i;
+
+  if (tree->freeNodes[leaf])
+  {
+    node = tree->freeNodes[leaf];
+    tree->freeNodes[leaf] = node->next;
+  }
+  else
+  {
+
+    if (leaf)
+    {
+      lines = (int) ( (offsetof(struct BPTNode, child) + (BPT_LINE - 1)) / BPT_LINE );
+    }
+    else
+    {
+      lines = (int) ( (sizeof(struct BPTNode) + (BPT_LINE - 1)) / BPT_LINE );
+    }
+
+    if (tree->unusedLines < lines)
+      _addSlab(tree);
+
+    node = (struct BPTNode*) tree->unused;
+
+    tree->unused += (unsigned long) lines * BPT_LINE;
+    tree->unusedLines -= lines;
+  }
+
+  node->count = 0;
+  node->leaf = leaf;
+  node->next = NULL;
+
+  for (i = 0; i < BPT_KEYS; i++)
+    _padKey(node, i);
+
+  return node;
+}
+
+void _freeNode(struct BPTree* tree, struct BPTNode* node)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns a node to the pool, on the free list for its kind, linked through 'next'.
+   */
+
+  node->next = tree->freeNodes[node->leaf];
+  tree->freeNodes[node->leaf] = node;
+}
+
+void _padKey(struct BPTNode* node, int i)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Fills an unused key slot with TYPE_MAX, so the SIMD search can compare whole nodes
+   *    without counting the unused slots. Without the SIMD search, slots are left as they are.
+   */
+
+#ifdef BPT_SIMD
+  node->keys[i] = TYPE_MAX;
+#else
+  (void) node;
+  (void) i;
+#endif
+}
+
+int _lowerBound(struct BPTNode* node, TYPE val)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Counts the node's keys that are less than the value, which is the position of the
+   *    first key not less than it.
+   *
+   *    With SIMD, all BPT_KEYS slots are compared 4 at a time, branch-free, and the
+   *    comparison masks are added up; padded slots (TYPE_MAX) never count.
+   *    Without SIMD, the keys are scanned in order.
+   *
+   *  Returns:
+   *    [int]     The number of keys less than 'val', from 0 to the node's count.
+   */
+
+#ifdef BPT_SIMD
+  __m128i target = _mm_set1_epi32(val);
+  __m128i less = _mm_setzero_si128();
+  int i;
+
+  /* Each compare yields -1 per lane with a smaller key; subtracting counts them */
+  for (i = 0; i < BPT_KEYS; i += 4)
+    less = _mm_sub_epi32(less, _mm_cmplt_epi32(_mm_loadu_si128((__m128i*) &node->keys[i]), target));
+
+  less = _mm_add_epi32(less, _mm_shuffle_epi32(less, _MM_SHUFFLE(1, 0, 3, 2)));
+  less = _mm_add_epi32(less, _mm_shuffle_epi32(less, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  /* Padded slots are never less, so the count is not read: it is off the keys' line */
+  return _mm_cvtsi128_si32(less);
+#else
+  int i = 0;
+
+  while ( (i < node->count) && LT(node->keys[i], val) )
+    i++;
+
+  return i;
+#endif
+}
+
+int _matchKey(struct BPTNode* node, int pos, TYPE val)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Checks if the node's key at the position, from " _lowerBound() ", is the value.
+   *
+   *    With SIMD, slots are padded, so the key is compared first and the count, which is off
+   *    the keys' line, is only read on a match (a padded slot only matches TYPE_MAX).
+   */
+
+#ifdef BPT_SIMD
+  return (pos < BPT_KEYS) && EQ(node->keys[pos], val) && (pos < node->count);
+#else
+  return (pos < node->count) && EQ(node->keys[pos], val);
+#endif
+}
+
+int _childIndex(struct BPTNode* node, TYPE val)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Finds the child of an internal node whose range holds the value: the number of
+   *    separators less than or equal to it.
+   */
+
+  int i = _lowerBound(node, val);
+
+  if ( _matchKey(node, i, val) )
+    i++;
+
+  return i;
+}
+
+struct BPTNode* _findLeaf(struct BPTree* tree, TYPE val)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Descends from the root to the leaf whose range holds the value, counting the tree's
+   *    levels rather than reading each node's 'leaf' flag, which is off the keys' line.
+   */
+
+  struct BPTNode* node = tree->root;
+  int level;
+
+  for (level = 0; level < tree->height; level++)
+    node = node->child[ _childIndex(node, val) ];
+
+  return node;
+}
+
+void _insertKey(struct BPTNode* node, int pos, TYPE val, struct BPTNode* right)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Shifts the keys from 'pos' onwards one slot to the right, and stores the value at 'pos'.
+   *    In an internal node, 'right' becomes the child just after the new key.
+   *
+   *  Pre-conditions:
+   *    - The node holds fewer than BPT_KEYS keys.
+   */
+
+  int i;
+
+  for (i = node->count; i > pos; i--)
+    node->keys[i] = node->keys[i - 1];
+
+  node->keys[pos] = val;
+
+  if (!node->leaf)
+  {
+
+    for (i = node->count + 1; i > pos + 1; i--)
+      node->child[i] = node->child[i - 1];
+
+    node->child[pos + 1] = right;
+  }
+
+  node->count++;
+}
+
+void _removeKey(struct BPTNode* node, int pos)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Removes the key at 'pos', shifting the following keys one slot to the left.
+   *    In an internal node, the child just after the key is removed with it.
+   */
+
+  int i;
+
+  for (i = pos; i < node->count - 1; i++)
+    node->keys[i] = node->keys[i + 1];
+
+  if (!node->leaf)
+  {
+
+    for (i = pos + 1; i < node->count; i++)
+      node->child[i] = node->child[i + 1];
+
+  }
+
+  node->count--;
+
+  _padKey(node, node->count);
+}
+
+struct BPTNode* _splitNode(struct BPTree* tree, struct BPTNode* node, TYPE* sep)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Splits a full node, moving its upper keys to a new right sibling:
+   *
+   *    - Leaf     -> the upper half of the keys moves; the new leaf is linked after this one.
+   *    - Internal -> the middle key moves up, out of both nodes, through 'sep';
+   *                  the keys after it move, with their children.
+   *
+   *  Returns:
+   *    [struct]  (BPTNode*): The new right sibling.
+   */
+
+  struct BPTNode* right;
+  int mid = BPT_KEYS / 2;
+  int from;
+  int i;
+
+  right = _newNode(tree, node->leaf);
+
+  from = node->leaf ? mid : mid + 1;
+
+  for (i = from; i < BPT_KEYS; i++)
+    right->keys[i - from] = node->keys[i];
+
+  right->count = BPT_KEYS - from;
+
+  if (node->leaf)
+  {
+    right->next = node->next;
+    node->next = right;
+  }
+  else
+  {
+    *sep = node->keys[mid];
+
+    for (i = from; i <= BPT_KEYS; i++)
+      right->child[i - from] = node->child[i];
+
+  }
+
+  node->count = mid;
+
+  for (i = mid; i < BPT_KEYS; i++)
+    _padKey(node, i);
+
+  return right;
+}
+
+void _borrowLeft(struct BPTNode* parent, int pos)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Moves one key from child 'pos - 1' into child 'pos', through the separator between them.
+   */
+
+  struct BPTNode* left = parent->child[pos - 1];
+  struct BPTNode* node = parent->child[pos];
+  int i;
+
+  for (i = node->count; i > 0; i--)
+    node->keys[i] = node->keys[i - 1];
+
+  if (node->leaf)
+  {
+    node->keys[0] = left->keys[left->count - 1];
+    parent->keys[pos - 1] = node->keys[0];
+  }
+  else
+  {
+
+    for (i = node->count + 1; i > 0; i--)
+      node->child[i] = node->child[i - 1];
+
+    node->keys[0] = parent->keys[pos - 1];
+    node->child[0] = left->child[left->count];
+
+    parent->keys[pos - 1] = left->keys[left->count - 1];
+  }
+
+  node->count++;
+  left->count--;
+
+  _padKey(left, left->count);
+}
+
+void _borrowRight(struct BPTNode* parent, int pos)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Moves one key from child 'pos + 1' into child 'pos', through the separator between them.
+   */
+
+  struct BPTNode* node = parent->child[pos];
+  struct BPTNode* right = parent->child[pos + 1];
+  int i;
+
+  if (node->leaf)
+  {
+    node->keys[node->count] = right->keys[0];
+  }
+  else
+  {
+    node->keys[node->count] = parent->keys[pos];
+    node->child[node->count + 1] = right->child[0];
+
+    parent->keys[pos] = right->keys[0];
+
+    for (i = 0; i < right->count; i++)
+      right->child[i] = right->child[i + 1];
+
+  }
+
+  node->count++;
+
+  for (i = 0; i < right->count - 1; i++)
+    right->keys[i] = right->keys[i + 1];
+
+  right->count--;
+
+  _padKey(right, right->count);
+
+  if (node->leaf)
+    parent->keys[pos] = right->keys[0];
+
+}
+
+void _mergeChildren(struct BPTree* tree, struct BPTNode* parent, int pos)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Merges child 'pos + 1' into child 'pos' and frees it. An internal merge pulls the
+   *    separator between them down; a leaf merge drops it. Either way, the separator and
+   *    the right child are removed from the parent.
+   *
+   *  Pre-conditions:
+   *    - Both children fit in one node.
+   */
+
+  struct BPTNode* left = parent->child[pos];
+  struct BPTNode* right = parent->child[pos + 1];
+  int i;
+
+  if (left->leaf)
+  {
+    left->next = right->next;
+  }
+  else
+  {
+    left->keys[left->count] = parent->keys[pos];
+    left->child[left->count + 1] = right->child[0];
+
+    left->count++;
+
+    for (i = 0; i < right->count; i++)
+      left->child[left->count + 1 + i] = right->child[i + 1];
+
+  }
+
+  for (i = 0; i < right->count; i++)
+    left->keys[left->count + i] = right->keys[i];
+
+  left->count += right->count;
+
+  _freeNode(tree, right);
+
+  _removeKey(parent, pos);
+}
+
+/* --------------------------------------------
+ *
+ *                END B+TREE
+ *
+ * --------------------------------------------
+ */
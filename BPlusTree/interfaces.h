@@ -0,0 +1,31 @@
+#include "structs.h"
+
+#ifndef __INTERFACES_H
+#define __INTERFACES_H
+
+/* B+TREE */
+void initBPT(struct BPTree* tree);
+void freeBPT(struct BPTree* tree);
+int containsBPT(struct BPTree* tree, TYPE val);
+int addBPT(struct BPTree* tree, TYPE val);
+int removeBPT(struct BPTree* tree, TYPE val);
+int rangeBPT(struct BPTree* tree, TYPE lo, TYPE hi, TYPE* out, int max);
+void printBPT(struct BPTree* tree);
+int isEmptyBPT(struct BPTree* tree);
+void _addSlab(struct BPTree* tree);
+struct BPTNode* _newNode(struct BPTree* tree, int leaf);
+void _freeNode(struct BPTree* tree, struct BPTNode* node);
+void _padKey(struct BPTNode* node, int i);
+int _lowerBound(struct BPTNode* node, TYPE val);
+int _matchKey(struct BPTNode* node, int pos, TYPE val);
+int _childIndex(struct BPTNode* node, TYPE val);
+struct BPTNode* _findLeaf(struct BPTree* tree, TYPE val);
+void _insertKey(struct BPTNode* node, int pos, TYPE val, struct BPTNode* right);
+void _removeKey(struct BPTNode* node, int pos);
+struct BPTNode* _splitNode(struct BPTree* tree, struct BPTNode* node, TYPE* sep);
+void _borrowLeft(struct BPTNode* parent, int pos);
+void _borrowRight(struct BPTNode* parent, int pos);
+void _mergeChildren(struct BPTree* tree, struct BPTNode* parent, int pos);
+/* END B+TREE */
+
+#endif
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "structs.h"
+#include "interfaces.h"
+
+
+int main(int argc, char const *argv[])
+{
+  struct BPTree bpt;
+  FILE* file;
+  const char* fileName;
+  int quantity;
+  int val;
+  int range[25];
+  int count;
+  int i;
+
+  if (argc == 2)
+  {
+    fileName = argv[1];
+  }
+  else
+  {
+    fileName = "input.txt";
+  } 
+
+  file = fopen(fileName,"r");
+
+  printf("\n--------------------------------------------\n");
+
+  printf("\nHello! I'm here to generate simple visualizations of some basic data structures:\n");
+  printf("- B+Tree\n\n");
+
+  printf("Press ENTER to continue.\n\n");
+  getchar();
+
+  /* --------------------------------------------
+   *
+   *                   B+TREE
+   * 
+   * --------------------------------------------
+   */
+
+  quantity = 25;
+
+  printf("Here are some B+Tree operations:\n\n");
+
+  initBPT(&bpt);
+
+  printf("- isEmpty: %d\n\n", isEmptyBPT(&bpt));
+
+  printf("- Adding values from %s...\n\n", fileName);
+
+  while ( !feof(file) && (quantity > 0) )
+  {
+    fscanf(file, "%d", &val);
+
+    addBPT(&bpt, val);
+
+    quantity--;
+  }
+
+  printf("- isEmpty: %d\n\n", isEmptyBPT(&bpt));
+
+  printf("- contains {747}?: %d\n\n", containsBPT(&bpt, 747));
+  printf("- contains {199}?: %d\n\n", containsBPT(&bpt, 199));
+  printf("- contains {500}?: %d\n\n", containsBPT(&bpt, 500));
+
+  printf("- Ready to print. Press ENTER.\n");
+  getchar();
+
+  printBPT(&bpt);
+
+  printf("\n- add {199}: %d\n", addBPT(&bpt, 199));
+  printf("- add {500}: %d\n", addBPT(&bpt, 500));
+
+  printf("\n- range {400..600}:");
+
+  count = rangeBPT(&bpt, 400, 600, range, 25);
+
+  for (i = 0; i < count; i++)
+    printf(" %d", range[i]);
+
+  printf("\n");
+
+  printf("\n- removing {747}: %d\n", removeBPT(&bpt, 747));
+  printf("- removing {747}: %d\n\n", removeBPT(&bpt, 747));
+
+  printf("- contains {747}?: %d\n", containsBPT(&bpt, 747));
+
+  printf("\n");
+
+  printf("- Freeing B+Tree memory.\n");
+
+  freeBPT(&bpt);
+
+  /* --------------------------------------------
+   *
+   *                 END B+TREE
+   * 
+   * --------------------------------------------
+   */
+
+  printf("\n--------------------------------------------\n");
+
+  fclose(file);
+  
+  return 0;
+}
@@ -0,0 +1,56 @@
+#ifndef __STRUCTS_H
+#define __STRUCTS_H
+
+# include <limits.h>
+
+# ifndef TYPE
+# define TYPE      int
+# define TYPE_SIZE sizeof(int)
+# define TYPE_MAX  INT_MAX
+# define TYPE_INT             /* Keys are plain ints: node searches may use SIMD compares */
+# define EQ(a,b) (a == b)
+# define LT(a,b) (a < b)
+# endif
+
+# define BPT_LINE       64                    /* Cache line size: nodes start on a line boundary */
+# define BPT_KEYS       16                    /* Keys per node: 16 int keys fill the node's first 64-byte line */
+# define BPT_MIN        ((BPT_KEYS - 1) / 2)  /* Fewest keys in a node other than the root */
+# define BPT_MAX_HEIGHT 24                    /* A B+tree this tall needs more than 8^22 keys */
+# define BPT_SLAB_LINES 1024                  /* Cache lines per slab added to the node pool */
+
+/* Slab of the node pool: the header is followed, from the next BPT_LINE boundary, by the lines nodes are carved from. */
+struct BPTSlab
+{
+  struct BPTSlab* next;
+};
+
+struct BPTree
+{
+  struct BPTNode* root;
+  int size;
+  int height;                     /* Levels above the leaves: descents count them, instead of reading 'leaf' */
+
+  struct BPTSlab* slabs;          /* Node pool: every node lives in one of these */
+  struct BPTNode* freeNodes[2];   /* Released internal nodes [0] and leaves [1], linked through 'next' */
+  char* unused;                   /* Lines never handed out, at the end of the newest slab */
+  int unusedLines;
+};
+
+/* Leaves and internal nodes share this layout. Leaves are allocated without
+ * the trailing 'child' array, so a leaf only takes the keys, counts and 'next'.
+ * Nodes are carved on BPT_LINE boundaries, so the keys are exactly the node's first line.
+ * Searches only read that line, and the line holding the child they follow: the count is
+ * only read on a key match, and descents count levels instead of reading 'leaf'. */
+struct BPTNode
+{
+  TYPE keys[BPT_KEYS];          /* Sorted; unused slots hold TYPE_MAX */
+
+  int count;
+  int leaf;
+
+  struct BPTNode* next;         /* Leaves: the next leaf in key order */
+
+  struct BPTNode* child[BPT_KEYS + 1];
+};
+
+#endif
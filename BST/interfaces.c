@@ -4,12 +4,21 @@
 #include "structs.h"
 #include "interfaces.h"
 
+#ifdef BST_STATS
+# define BST_CALL(tree, op)       ((tree)->stats.calls[op]++)
+# define BST_COMPARE(tree, op, n) ((tree)->stats.compares[op] += (n))
+#else
+# define BST_CALL(tree, op)       ((void) (tree))
+# define BST_COMPARE(tree, op, n) ((void) (tree))
+#endif
+
 
 void initBST(struct BST* tree)
 {
   /*  Description:
    *    Function initializes a BST structure using a pointer to its memory address.
-   *    The function does not allocate additional memory upon initialization.
+   *    The function does not allocate additional memory upon initialization; nodes are
+   *    allocated later, in slabs, by " _newNode() ".
    *    
    *  Parameters:
    *    [struct] (BST*) tree: A pointer to the BST.
@@ -19,41 +28,83 @@ void initBST(struct BST* tree)
    * 
    *  Post-conditions:
    *    - The BST is initialized: the size is 0, and the root points to NULL.
+   *    - Duplicate values are stored as separate nodes.
    */
 
   assert(tree);
 
   tree->size = 0;
   tree->root = NULL;
+  tree->multiset = 0;
+
+  tree->slabs = NULL;
+  tree->freeNodes = NULL;
+  tree->unused = 0;
+
+  resetStatsBST(tree);
+}
+
+void initMultisetBST(struct BST* tree)
+{
+  /*  Description:
+   *    Function initializes a BST structure in multiset mode: adding a value that is
+   *    already contained increments its node's count, instead of creating a duplicate node.
+   *    
+   *  Parameters:
+   *    [struct] (BST*) tree: A pointer to the BST.
+   * 
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   * 
+   *  Post-conditions:
+   *    - The BST is initialized: the size is 0, the root points to NULL, and multiset mode is on.
+   */
+
+  initBST(tree);
+
+  tree->multiset = 1;
 }
 
 void freeBST(struct BST* tree)
 {
   /*  Description:
-   *    Function calls recursive function " _freePostOrder() " to free all nodes,
-   *    in post-order.
+   *    Complexity O(n / BST_SLAB_NODES).
+   *    Function frees the node pool one slab at a time; the nodes themselves are not visited.
    *    
    *  Parameters:
    *    [struct] (BST*) tree: A pointer to the BST.
    * 
    *  Pre-conditions:
    *    - Pointer 'tree' points to a proper memory location.
-   *    - The BST is correctly linked.
+   *    - The BST was initialized correctly.
    * 
    *  Post-conditions:
-   *    - The BST's memory is freed.
+   *    - The BST's memory is freed, and it is empty.
    */
 
+  struct Slab* slab;
+
   assert(tree);
 
-  _freePostOrder(tree->root);
+  while (tree->slabs)
+  {
+    slab = tree->slabs;
+    tree->slabs = slab->next;
+
+    free(slab);
+  }
+
+  tree->root = NULL;
+  tree->size = 0;
+  tree->freeNodes = NULL;
+  tree->unused = 0;
 }
 
 int containsBST(struct BST* tree, TYPE val)
 {
   /*  Description:
-   *    For a well balanced tree, complexity O(log₂(n)).
-   *    Function calls recursive function " _containsNode() " to traverse the BST,
+   *    Complexity O(log₂(n)); the BST is kept AVL-balanced by " _addNode() " and " _removeNode() ".
+   *    Function calls iterative function " _containsNode() " to traverse the BST,
    *    and determine whether the value is contained within it.
    *    
    *  Parameters:
@@ -69,6 +120,8 @@ int containsBST(struct BST* tree, TYPE val)
    */
 
   assert(tree);
+
+  BST_CALL(tree, BST_OP_CONTAINS);
   
   if ( isEmptyBST(tree) )
   {
@@ -76,7 +129,7 @@ int containsBST(struct BST* tree, TYPE val)
   }
   else
   {
-    return _containsNode(tree->root, val);
+    return _containsNode(tree, tree->root, val);
   }
   
 }
@@ -84,9 +137,10 @@ int containsBST(struct BST* tree, TYPE val)
 void addBST(struct BST* tree, TYPE val)
 {
   /*  Description:
-   *    For a well balanced tree, complexity O(log₂(n)).
-   *    Function calls recursive function " _addNode() " to traverse the BST,
+   *    Complexity O(log₂(n)); the BST is kept AVL-balanced by " _addNode() " and " _removeNode() ".
+   *    Function calls iterative function " _addNode() " to traverse the BST,
    *    and correctly add a node with the value, maintaining BST principles.
+   *    In multiset mode, a value that is already contained has its node's count incremented instead.
    *    
    *  Parameters:
    *    [struct] (BST*) tree: A pointer to the BST.
@@ -102,22 +156,66 @@ void addBST(struct BST* tree, TYPE val)
 
   assert(tree);
 
-  tree->root = _addNode(tree->root, val);
+  BST_CALL(tree, BST_OP_ADD);
+
+  _addNode(tree, &tree->root, val, tree->multiset ? BST_ADD_COUNT : BST_ADD_ALWAYS);
 
   tree->size++;
 }
 
-void removeBST(struct BST* tree, TYPE val)
+int insertUniqueBST(struct BST* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function calls iterative function " _addNode() " to add the value only if it is not
+   *    already contained, using a single descent.
+   *    
+   *  Parameters:
+   *    [struct] (BST*) tree: A pointer to the BST.
+   *    [TYPE]           val: The value to insert.
+   * 
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was added, False if it was already contained.
+   * 
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The BST is correctly linked.
+   * 
+   *  Post-conditions:
+   *    - The value is contained in the BST exactly as often as before, or once if it was absent.
+   */
+
+  assert(tree);
+
+  BST_CALL(tree, BST_OP_ADD);
+
+  if ( _addNode(tree, &tree->root, val, BST_ADD_UNIQUE) )
+  {
+    tree->size++;
+
+    return 1;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+int removeBST(struct BST* tree, TYPE val)
 {
   /*  Description:
-   *    For a well balanced tree, complexity O(log₂(n)).
-   *    Function calls recursive function " _removeNode() " to traverse the BST,
-   *    and correctly remove a value, maintaining BST principles.
+   *    Complexity O(log₂(n)); the BST is kept AVL-balanced by " _addNode() " and " _removeNode() ".
+   *    Function calls iterative function " _removeNode() " to traverse the BST once,
+   *    and correctly remove one copy of a value, maintaining BST principles.
    *    
    *  Parameters:
    *    [struct] (BST*) tree: A pointer to the BST.
    *    [TYPE]           val: The value to remove.
    * 
+   *  Returns:
+   *    [int]     (1 || 0): True if a value was removed, False if it was not contained.
+   * 
    *  Pre-conditions:
    *    - Pointer 'tree' points to a proper memory location.
    *    - The BST is correctly linked.
@@ -128,11 +226,17 @@ void removeBST(struct BST* tree, TYPE val)
 
   assert(tree);
 
-  if ( containsBST(tree, val) )
-  {
-    tree->root = _removeNode(tree->root, val);
+  BST_CALL(tree, BST_OP_REMOVE);
 
+  if ( _removeNode(tree, &tree->root, val) )
+  {
     tree->size--;
+
+    return 1;
+  }
+  else
+  {
+    return 0;
   }
   
 }
@@ -140,7 +244,7 @@ void removeBST(struct BST* tree, TYPE val)
 void printBST(struct BST* tree)
 {
   /*  Description:
-   *    Function calls recursive function " _printInOrder() " to traverse the BST,
+   *    Function calls iterative function " _printInOrder() " to traverse the BST,
    *    and print the nodes in-order.
    *    
    *  Parameters:
@@ -191,287 +295,2455 @@ int isEmptyBST(struct BST* tree)
   
 }
 
-struct Node* _addNode(struct Node* curr, TYPE val)
+int _addNode(struct BST* tree, struct Node** link, TYPE val, int mode)
 {
   /*  Description:
-   *    Recursive auxiliary function.
-   *    Traverses the BST using binary search. Upon encountering
-   *    a NULL pointer, allocates memory for a new node with the given value.
-   *    After creating the new node, the function returns the node and further
-   *    recursion stops. The BST is correctly re-linked as each recursive call
-   *    returns.
+   *    Iterative auxiliary function.
+   *    Traverses the BST using binary search, descending through the child pointers
+   *    themselves (pointer-to-pointer), and recording each one on a path. Upon encountering
+   *    a NULL pointer, takes a new node from the pool (" _newNode() "), with the given value,
+   *    and links it in place. The sizes along the path are then adjusted by " _resizePath() ", and
+   *    the path is retraced by " _retracePath() " to re-balance the BST.
+   * 
+   *    Upon encountering a node with the given value, the mode decides:
+   * 
+   *    - BST_ADD_ALWAYS -> keep descending (right), a duplicate node is added.
+   *    - BST_ADD_UNIQUE -> stop, nothing is added.
+   *    - BST_ADD_COUNT  -> stop, the node holds one more copy.
    *    
    *  Parameters:
-   *    [struct] (Node*) curr: A pointer to the next node to traverse from.
-   *    [TYPE]           val : The value to insert.
+   *    [struct] (BST*)   tree: A pointer to the BST, which owns the node pool.
+   *    [struct] (Node**) link: A pointer to the child pointer (or root) to traverse from.
+   *    [TYPE]            val : The value to insert.
+   *    [int]             mode: BST_ADD_ALWAYS, BST_ADD_UNIQUE or BST_ADD_COUNT.
+   * 
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was added (as a node or a count), False if not.
    * 
    *  Pre-conditions:
-   *    - Pointer 'curr' points to a proper memory location.
+   *    - Pointer 'link' points to a proper memory location.
    *    - The BST is correctly linked.
    * 
    *  Post-conditions:
-   *    - The function adds and links the given value to the BST.
+   *    - The function adds and links the given value to the BST, as the mode decides.
    */
 
+  struct Node** path[BST_MAX_HEIGHT];
   struct Node* node;
+  int depth = 0;
 
-  /* When the current node is a NULL pointer, create the new node */
-  if (curr == NULL)
+  /* Binary search, remembering every link on the way down */
+  while (*link)
   {
-    node = (struct Node*) malloc(sizeof(struct Node));
+    BST_COMPARE(tree, BST_OP_ADD, 1);
 
-    assert(node);
+    if ( (mode != BST_ADD_ALWAYS) && EQ(val, (*link)->val) )
+    {
 
-    node->val = val;
-    node->left = NULL;
-    node->right = NULL;
+      if (mode == BST_ADD_COUNT)
+      {
+        /* One more copy: only sizes change, the shape does not */
+        path[depth++] = link;
 
-    /* Returns the newly created node to the previous recursive call,
-     * and any previous recursive calls return, consecutively. */
-    return node;
-  }
-  else
-  {
+        _resizePath(path, depth, 1);
+
+        return 1;
+      }
+
+      return 0;
+    }
+
+    path[depth++] = link;
 
-    /* Binary search */
-    if ( LT(val, curr->val) )
+    if ( LT(val, (*link)->val) )
     {
-      /* Traverse left subtree */
-      curr->left = _addNode(curr->left, val);
+      link = &(*link)->left;
     }
     else
     {
-      /* Traverse right subtree */
-      curr->right = _addNode(curr->right, val);
+      link = &(*link)->right;
     }
 
   }
-  
-  /* As recursive calls return in cascade, each unchanged child node is 
-   * correctly returned to the previous parent node. */
-  return curr;
+
+  node = _newNode(tree);
+
+  node->val = val;
+  node->left = NULL;
+  node->right = NULL;
+  node->height = 1;
+  node->size = 1;
+
+  *link = node;
+
+  _resizePath(path, depth, 1);
+  _retracePath(path, depth);
+
+  return 1;
 }
 
-struct Node* _removeNode(struct Node* curr, TYPE val)
+int _removeNode(struct BST* tree, struct Node** link, TYPE val)
 {
   /*  Description:
-   *    Recursive auxiliary function.
-   *    Traverses the BST using binary search. Upon encountering
-   *    the node with the given value, the function determines if it has a right child node:
+   *    Iterative auxiliary function.
+   *    Traverses the BST using binary search, recording each child pointer on a path. Upon encountering
+   *    the node with the given value, if the node holds more than one copy (multiset mode), it gives
+   *    up one. Otherwise, the function determines if it has a right child node:
    * 
-   *    - No child    -> the function frees the removal node, and returns its left child (NULL or otherwise),
-   *                     ending further recursion.
-   *    - Right child -> the function finds the leftmost descendant of the right child, overwrites the removal
-   *                     node with its value, and calls recursive function " _removeLeftmost " to
-   *                     remove its original node and properly re-link any children nodes. The function
-   *                     then returns the current node with the overwritten value, ending further recursion.
+   *    - No child    -> the removal node's left child (NULL or otherwise) takes its place, and
+   *                     the removal node is released to the pool.
+   *    - Right child -> the function calls " _removeLeftmost() " on the right child, which unlinks
+   *                     the leftmost descendant, extending the path as it descends. The removal node
+   *                     is overwritten with its value and copies, and it is released to the pool.
    *    
-   *    As the recursive calls return in cascade, each node maintains correct linkage.
+   *    The sizes along the path are then adjusted by " _resizePath() ", and the path is retraced
+   *    by " _retracePath() " to re-balance the BST.
+   *    If the value is not found, the BST is left untouched.
    *    
    *  Parameters:
-   *    [struct] (Node*) curr: A pointer to the next node to traverse from.
-   *    [TYPE]           val : The value to remove.
+   *    [struct] (BST*)   tree: A pointer to the BST, which owns the node pool.
+   *    [struct] (Node**) link: A pointer to the child pointer (or root) to traverse from.
+   *    [TYPE]            val : The value to remove.
    * 
    *  Pre-conditions:
-   *    - Pointer 'curr' points to a proper memory location.
+   *    - Pointer 'link' points to a proper memory location.
    *    - The BST is correctly linked.
    * 
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was found and removed, False if not.
+   * 
    *  Post-conditions:
-   *    - The node with the given value is removed, its memory is freed, and BST principles are maintained.
+   *    - The node with the given value is removed, its memory is released, and BST principles are maintained.
    */
 
+  struct Node** path[BST_MAX_HEIGHT];
   struct Node* node;
+  struct Node* leftmost;
+  int depth = 0;
+  int top;
+  int count;
 
-  if ( EQ(val, curr->val) )
+  while ( *link && !EQ(val, (*link)->val) )
   {
+    BST_COMPARE(tree, BST_OP_REMOVE, 1);
 
-    if (curr->right == NULL)
-    {
-      node = curr->left;
-
-      free(curr);
+    path[depth++] = link;
 
-      return node;
+    if ( LT(val, (*link)->val) )
+    {
+      link = &(*link)->left;
     }
     else
     {
-      /* Finding leftmost descendant of the right child */
-      /* { */
-      node = curr->right;
+      link = &(*link)->right;
+    }
 
-      while (node->left)
-      {
-        node = node->left;
-      }
-      /* } */
+  }
 
-      curr->val = node->val;
-      curr->right = _removeLeftmost(curr->right);
+  node = *link;
 
-    }
-    
+  if (node == NULL)
+    return 0;
+
+  BST_COMPARE(tree, BST_OP_REMOVE, 1);
+
+  if (_countNode(node) > 1)
+  {
+    /* One copy less: only sizes change, the shape does not */
+    path[depth++] = link;
+
+    _resizePath(path, depth, -1);
+
+    return 1;
+  }
+
+  if (node->right == NULL)
+  {
+    *link = node->left;
+
+    _freeNode(tree, node);
+
+    _resizePath(path, depth, -1);
   }
   else
   {
+    path[depth++] = link;
+    top = depth;
 
-    /* Binary search */
-    if ( LT(val, curr->val) )
-    {
-      /* Traverse left subtree */
-      curr->left = _removeNode(curr->left, val);
-    }
-    else
-    {
-      /* Traverse right subtree */
-      curr->right = _removeNode(curr->right, val);
-    }
+    leftmost = _removeLeftmost(&node->right, path, &depth);
+    count = _countNode(leftmost);
 
+    node->val = leftmost->val;
+
+    _freeNode(tree, leftmost);
+
+    /* The removal node and its ancestors lose its one copy; the subtrees the leftmost
+     * descendant left lose all of its copies, which the removal node now holds */
+    _resizePath(path, top, -1);
+    _resizePath(path + top, depth - top, -count);
   }
 
-  /* As recursive calls return in cascade, each unchanged child node is 
-   * correctly returned to the previous parent node. */
-  return curr;
+  _retracePath(path, depth);
+
+  return 1;
 }
 
-struct Node* _removeLeftmost(struct Node* curr)
+struct Node* _removeLeftmost(struct Node** link, struct Node** path[], int* depth)
 {
   /*  Description:
-   *    Recursive auxiliary function.
-   *    Traverses the BST through only left child nodes. Upon encountering
-   *    a NULL left child pointer, the function frees the current node (the leftmost descendant), and
-   *    returns its right child node, ending further recursion.
-   *    As the recursive calls return in cascade, each node maintains correct linkage.
+   *    Iterative auxiliary function.
+   *    Traverses the BST through only left child nodes, recording each child pointer on the path.
+   *    Upon encountering a NULL left child pointer, the function unlinks the current node
+   *    (the leftmost descendant), and lets its right child take its place.
+   *    Re-balancing and freeing are left to the caller, which retraces the extended path.
    *    
    *  Parameters:
-   *    [struct] (Node*) curr: A pointer to the next node to traverse from.
+   *    [struct] (Node**)   link : A pointer to the child pointer to traverse from.
+   *    [struct] (Node**[]) path : The path of child pointers leading to 'link'.
+   *    [int]    (int*)     depth: The path's length; updated as the path is extended.
+   * 
+   *  Returns:
+   *    [struct]  (Node*): The unlinked leftmost descendant.
    * 
    *  Pre-conditions:
-   *    - Pointer 'curr' points to a proper memory location.
+   *    - Pointer 'link' points to a non-NULL child pointer.
    *    - The BST is correctly linked.
    * 
    *  Post-conditions:
-   *    - The leftmost descendant is removed, its memory is freed, and its right child takes its place.
+   *    - The leftmost descendant is unlinked, and its right child takes its place.
    */
 
   struct Node* node;
 
-  if(curr->left)
+  while ( (*link)->left )
   {
-    curr->left = _removeLeftmost(curr->left);
+    path[(*depth)++] = link;
 
-    return curr;
+    link = &(*link)->left;
   }
-  else
-  {
-    node = curr->right;
 
-    free(curr);
+  node = *link;
 
-    return node;
-  }
+  *link = node->right;
 
+  return node;
 }
 
-int _containsNode(struct Node* curr, TYPE val)
+int _containsNode(struct BST* tree, struct Node* curr, TYPE val)
 {
   /*  Description:
-   *    Recursive auxiliary function.
-   *    Traverses the BST using binary search. Upon encountering
-   *    the node with the given value, the function returns True (1) to the previous
-   *    recursive call, ending further recursion. Else, the function traverses until
-   *    encountering a NULL child node pointer, indicating the absence of the given value in the BST.
-   *    This ends further recursion, and as the recursive calls return in cascade,
-   *    either True (1) or False (0) will be returned to the origin call.
+   *    Iterative auxiliary function.
+   *    Traverses the BST using binary search. Upon encountering the node with the given value,
+   *    the function returns True (1). Upon reaching a NULL child node pointer,
+   *    the value is absent from the BST, and the function returns False (0).
    *    
    *  Parameters:
-   *    [struct] (Node*) curr: A pointer to the next node to traverse from.
+   *    [struct] (BST*)  tree: A pointer to the BST, whose comparisons are counted.
+   *    [struct] (Node*) curr: A pointer to the node to traverse from.
    *    [TYPE]           val : The value to search for.
    * 
    *  Pre-conditions:
-   *    - Pointer 'curr' points to a proper memory location.
    *    - The BST is correctly linked.
    * 
    *  Post-conditions:
-   *    - The BST is traversed, and upon reaching the value or upon reaching
-   *      a NULL child node pointer, the function returns True (1) or False (0), accordingly.
+   *    - True (1) or False (0) is returned, accordingly.
    */
 
-  int flag = 0;
-
-  if ( EQ(val, curr->val) )
+  while (curr)
   {
-    flag = 1;
-  }
-  else
-  {
-    /*  Checks for "curr->left" and "curr->right" to identify
-     *  NULL child nodes, and if there's no where to traverse,
-     *  then the functions flows naturally and returns the initial
-     *  flag value of 0.
-     */
-    
-    if ( LT(val, curr->val) && curr->left)
+    BST_COMPARE(tree, BST_OP_CONTAINS, 1);
+
+    if ( EQ(val, curr->val) )
     {
-      flag = _containsNode(curr->left, val);
+      return 1;
     }
-    else if (curr->right)
+    else if ( LT(val, curr->val) )
     {
-      flag = _containsNode(curr->right, val);
+      curr = curr->left;
+    }
+    else
+    {
+      curr = curr->right;
     }
 
   }
-  
-  return flag;
+
+  return 0;
 }
 
 void _printInOrder(struct Node* curr)
 {
   /*  Description:
-   *    Recursive auxiliary function.
-   *    Traverses the BST and prints node values in-order.
+   *    Iterative auxiliary function.
+   *    Traverses the BST and prints node values in-order. Ancestors still to be printed are kept
+   *    on an explicit stack, whose size is bounded by the AVL height.
    *    
    *  Parameters:
-   *    [struct] (Node*) curr: A pointer to the next node to traverse from.
+   *    [struct] (Node*) curr: A pointer to the node to traverse from.
    * 
    *  Pre-conditions:
-   *    - Pointer 'curr' points to a proper memory location.
    *    - The BST is correctly linked.
    * 
    *  Post-conditions:
    *    - The BST is traversed and node values are printed to stdout in-order.
    */
 
-  if (curr)
+  struct Node* stack[BST_MAX_HEIGHT];
+  int top = 0;
+  int count;
+
+  while (curr || top > 0)
   {
-    _printInOrder(curr->left);
-    printf("Node with value: { %d }\n", curr->val);
-    _printInOrder(curr->right);
+
+    /* Descend left, stacking each node to print on the way back */
+    while (curr)
+    {
+      stack[top++] = curr;
+      curr = curr->left;
+    }
+
+    curr = stack[--top];
+    count = _countNode(curr);
+
+    if (count > 1)
+    {
+      printf("Node with value: { %d } (x%d)\n", curr->val, count);
+    }
+    else
+    {
+      printf("Node with value: { %d }\n", curr->val);
+    }
+
+    curr = curr->right;
   }
-  
+
 }
 
-void _freePostOrder(struct Node* curr)
+void _retracePath(struct Node** path[], int depth)
 {
   /*  Description:
-   *    Recursive auxiliary function.
-   *    Traverses the BST and frees node memory allocations post-order.
+   *    Iterative auxiliary function.
+   *    Walks a path of child pointers back up from the deepest one, re-balancing each subtree
+   *    in place. Rotations keep subtree sizes, so once a subtree's height comes out unchanged,
+   *    its ancestors are left as they are.
    *    
    *  Parameters:
-   *    [struct] (Node*) curr: A pointer to the next node to traverse from.
+   *    [struct] (Node**[]) path : The child pointers from the root downwards.
+   *    [int]               depth: The number of child pointers on the path.
    * 
    *  Pre-conditions:
-   *    - Pointer 'curr' points to a proper memory location.
-   *    - The BST is correctly linked.
+   *    - The sizes along the path are correct (see " _resizePath() ").
    * 
    *  Post-conditions:
-   *    - The BST is traversed and node memory allocations are freed post-order.
+   *    - Every subtree on the path is AVL-balanced with correct heights and sizes.
+   */
+
+  int oldHeight;
+
+  while (depth > 0)
+  {
+    depth--;
+
+    oldHeight = (*path[depth])->height;
+
+    *path[depth] = _rebalance(*path[depth]);
+
+    if ( (*path[depth])->height == oldHeight )
+      break;
+
+  }
+
+}
+
+void _resizePath(struct Node** path[], int depth, int delta)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Adds the change in copies to the size of every subtree on a path of child pointers,
+   *    before it is retraced. Sizes are kept this way, rather than summed from children, as a
+   *    node's own count is only known from its size (see " _countNode() ").
+   *    
+   *  Parameters:
+   *    [struct] (Node**[]) path : The child pointers from the root downwards.
+   *    [int]               depth: The number of child pointers on the path.
+   *    [int]               delta: The copies added (or, if negative, removed) below each one.
+   */
+
+  while (depth > 0)
+  {
+    depth--;
+
+    (*path[depth])->size += delta;
+  }
+
+}
+
+int _sizeNode(struct Node* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns the stored subtree size of the node, counting every copy, where a NULL pointer has size 0.
    */
 
   if (curr)
   {
-    _freePostOrder(curr->left);
-    _freePostOrder(curr->right);
-    free(curr);
+    return curr->size;
   }
-  
+  else
+  {
+    return 0;
+  }
+
+}
+
+int _countNode(struct Node* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns the copies of its value the node holds: its subtree size less its children's.
+   *    
+   *  Pre-conditions:
+   *    - The node and its children have correct sizes.
+   */
+
+  return curr->size - _sizeNode(curr->left) - _sizeNode(curr->right);
+}
+
+int _heightNode(struct Node* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns the stored AVL height of the node, where a NULL pointer has height 0.
+   */
+
+  if (curr)
+  {
+    return curr->height;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+void _updateHeight(struct Node* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Recomputes the node's height from its children's stored ones.
+   *    
+   *  Pre-conditions:
+   *    - The children's heights are correct.
+   */
+
+  int left = _heightNode(curr->left);
+  int right = _heightNode(curr->right);
+
+  curr->height = 1 + ((left > right) ? left : right);
+}
+
+struct Node* _rotateLeft(struct Node* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Rotates the subtree left: the right child becomes the subtree root,
+   *    and the current node becomes its left child. The right child's left subtree
+   *    is handed over as the current node's new right subtree.
+   *    
+   *  Post-conditions:
+   *    - The new subtree root is returned, in-order sequence, heights and sizes are maintained.
+   */
+
+  struct Node* right = curr->right;
+  int size = curr->size;
+
+  /* The subtree keeps its size; the current node gives up the right child's, less its left subtree */
+  curr->size = size - right->size + _sizeNode(right->left);
+  right->size = size;
+
+  curr->right = right->left;
+  right->left = curr;
+
+  _updateHeight(curr);
+  _updateHeight(right);
+
+  return right;
+}
+
+struct Node* _rotateRight(struct Node* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Rotates the subtree right: the left child becomes the subtree root,
+   *    and the current node becomes its right child. Mirror of " _rotateLeft() ".
+   *    
+   *  Post-conditions:
+   *    - The new subtree root is returned, in-order sequence, heights and sizes are maintained.
+   */
+
+  struct Node* left = curr->left;
+  int size = curr->size;
+
+  curr->size = size - left->size + _sizeNode(left->right);
+  left->size = size;
+
+  curr->left = left->right;
+  left->right = curr;
+
+  _updateHeight(curr);
+  _updateHeight(left);
+
+  return left;
+}
+
+struct Node* _rebalance(struct Node* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Restores the AVL property at the current node, whose children are AVL trees differing
+   *    in height by at most 2:
+   *    
+   *    - Left-heavy  -> rotate right (first rotating the left child left, if it leans right).
+   *    - Right-heavy -> rotate left (first rotating the right child right, if it leans left).
+   *    
+   *  Parameters:
+   *    [struct] (Node*) curr: A pointer to the subtree root to re-balance.
+   * 
+   *  Pre-conditions:
+   *    - The subtree's sizes are correct.
+   * 
+   *  Post-conditions:
+   *    - The subtree's heights are updated, its height difference is at most 1,
+   *      and the new subtree root is returned.
+   */
+
+  int balance;
+
+  _updateHeight(curr);
+
+  balance = _heightNode(curr->left) - _heightNode(curr->right);
+
+  if (balance > 1)
+  {
+
+    if ( _heightNode(curr->left->left) < _heightNode(curr->left->right) )
+      curr->left = _rotateLeft(curr->left);
+
+    return _rotateRight(curr);
+  }
+  else if (balance < -1)
+  {
+
+    if ( _heightNode(curr->right->right) < _heightNode(curr->right->left) )
+      curr->right = _rotateRight(curr->right);
+
+    return _rotateLeft(curr);
+  }
+
+  return curr;
+}
+
+void freezeBST(struct BST* tree, struct FrozenBST* frozen)
+{
+  /*  Description:
+   *    Complexity O(n).
+   *    Function writes a read-only snapshot of the BST into a flat array, in Eytzinger order:
+   *    the array is a complete binary tree laid out level by level, so a search touches the
+   *    top levels in the same few cache lines every time, and the next levels' addresses are
+   *    known in advance and can be prefetched.
+   *    The BST is walked in-order, while the array positions are walked in their own in-order.
+   *    In multiset mode, each copy of a value gets its own position.
+   *    
+   *  Parameters:
+   *    [struct] (BST*)       tree  : A pointer to the BST.
+   *    [struct] (FrozenBST*) frozen: A pointer to the snapshot to fill.
+   * 
+   *  Pre-conditions:
+   *    - Pointers 'tree' and 'frozen' point to proper memory locations.
+   *    - The BST is correctly linked.
+   * 
+   *  Post-conditions:
+   *    - The snapshot holds every value of the BST; later changes to the BST do not affect it.
+   */
+
+  struct Node* stack[BST_MAX_HEIGHT];
+  struct Node* curr;
+  int top = 0;
+  int copy;
+  int copies;
+  int k;
+  int n;
+
+  assert(tree);
+  assert(frozen);
+
+  n = tree->size;
+
+  frozen->size = n;
+  frozen->keys = (TYPE*) malloc(sizeof(TYPE) * (n + 1));
+
+  assert(frozen->keys);
+
+  /* First array position in-order: the leftmost one */
+  k = 1;
+
+  while (2 * k <= n)
+    k = 2 * k;
+
+  curr = tree->root;
+
+  while (curr || top > 0)
+  {
+
+    while (curr)
+    {
+      stack[top++] = curr;
+      curr = curr->left;
+    }
+
+    curr = stack[--top];
+
+    copies = _countNode(curr);
+
+    for (copy = 0; copy < copies; copy++)
+    {
+      frozen->keys[k] = curr->val;
+
+      /* Next array position in-order: leftmost of the right subtree, else the first
+       * ancestor reached from a left child */
+      if (2 * k + 1 <= n)
+      {
+        k = 2 * k + 1;
+
+        while (2 * k <= n)
+          k = 2 * k;
+
+      }
+      else
+      {
+
+        while (k & 1)
+          k >>= 1;
+
+        k >>= 1;
+      }
+
+    }
+
+    curr = curr->right;
+  }
+
+}
+
+void freeFrozenBST(struct FrozenBST* frozen)
+{
+  /*  Description:
+   *    Function frees the snapshot's array.
+   * 
+   *  Post-conditions:
+   *    - The snapshot's memory is freed, and it is empty.
+   */
+
+  assert(frozen);
+
+  free(frozen->keys);
+
+  frozen->keys = NULL;
+  frozen->size = 0;
+}
+
+int containsFrozenBST(struct FrozenBST* frozen, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function searches the snapshot without a data-dependent branch: at position k, the search
+   *    moves to 2k + (keys[k] < val), so it always descends to the bottom. Each step prefetches
+   *    the position 4 levels further down (16 positions, one cache line of int values),
+   *    hiding most of the memory latency. The first value not less than 'val' is the last
+   *    position at which the search went left.
+   *    
+   *  Parameters:
+   *    [struct] (FrozenBST*) frozen: A pointer to the snapshot.
+   *    [TYPE]                val   : The value to search for.
+   * 
+   *  Pre-conditions:
+   *    - The snapshot was filled by " freezeBST() ".
+   * 
+   *  Post-conditions:
+   *    - The function returns True (1) if the value is contained, or False (0) if not.
+   */
+
+  int k = 1;
+
+  assert(frozen);
+
+  while (k <= frozen->size)
+  {
+    _prefetchFrozen(frozen, k);
+
+    k = 2 * k + LT(frozen->keys[k], val);
+  }
+
+  k = _lowerBoundFrozen(k);
+
+  return k && EQ(frozen->keys[k], val);
+}
+
+void containsManyFrozenBST(struct FrozenBST* frozen, TYPE* vals, int n, int* out)
+{
+  /*  Description:
+   *    Complexity O(n log₂(m)), for a snapshot of m values.
+   *    Function runs the searches of " containsFrozenBST() " FROZEN_BATCH at a time, in lockstep:
+   *    every search of the batch takes one step per level before any takes the next. The
+   *    batch's memory accesses are independent, so they overlap instead of waiting on one another.
+   *    Every search of the batch takes the same number of steps; only the last level can be
+   *    partly missing, and only there is the position checked against the size.
+   *    
+   *  Parameters:
+   *    [struct] (FrozenBST*) frozen: A pointer to the snapshot.
+   *    [TYPE]   (TYPE*)      vals  : The values to search for.
+   *    [int]                 n     : The number of values.
+   *    [int]    (int*)       out   : Receives True (1) or False (0) for each value.
+   * 
+   *  Pre-conditions:
+   *    - The snapshot was filled by " freezeBST() ".
+   *    - Pointers 'vals' and 'out' point to arrays of at least 'n' elements.
+   * 
+   *  Post-conditions:
+   *    - out[i] is True (1) if vals[i] is contained, or False (0) if not.
+   */
+
+  int k[FROZEN_BATCH];
+  int levels;
+  int level;
+  int batch;
+  int i;
+  int j;
+
+  assert(frozen);
+
+  /* Levels every search completes: positions 1 .. 2^levels - 1 all exist */
+  levels = 0;
+
+  while ( (2 << levels) - 1 <= frozen->size )
+    levels++;
+
+  for (i = 0; i < n; i += FROZEN_BATCH)
+  {
+    batch = (n - i < FROZEN_BATCH) ? (n - i) : FROZEN_BATCH;
+
+    for (j = 0; j < batch; j++)
+      k[j] = 1;
+
+    for (level = 0; level < levels; level++)
+    {
+
+      for (j = 0; j < batch; j++)
+      {
+        _prefetchFrozen(frozen, k[j]);
+
+        k[j] = 2 * k[j] + LT(frozen->keys[ k[j] ], vals[i + j]);
+      }
+
+    }
+
+    for (j = 0; j < batch; j++)
+    {
+
+      if (k[j] <= frozen->size)
+        k[j] = 2 * k[j] + LT(frozen->keys[ k[j] ], vals[i + j]);
+
+      k[j] = _lowerBoundFrozen(k[j]);
+
+      out[i + j] = k[j] && EQ(frozen->keys[ k[j] ], vals[i + j]);
+    }
+
+  }
+
+}
+
+int _lowerBoundFrozen(int k)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Given the position a search fell off the bottom at, undoes its trailing right turns and
+   *    the last left turn, which lands on the first value not less than the searched value.
+   * 
+   *  Returns:
+   *    [int]     The position of that value, or 0 if every value is less.
+   */
+
+#ifdef __GNUC__
+  return k >> __builtin_ffs(~k);
+#else
+  while (k & 1)
+    k >>= 1;
+
+  return k >> 1;
+#endif
+}
+
+void _prefetchFrozen(struct FrozenBST* frozen, int k)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Prefetches the descendants of position k four levels down, which are 16 consecutive
+   *    positions. Prefetching past the end of the array is harmless; it is never read.
+   */
+
+#ifdef __GNUC__
+  __builtin_prefetch(frozen->keys + 16 * (long) k);
+#else
+  (void) frozen;
+  (void) k;
+#endif
+}
+
+void buildBST(struct BST* tree, TYPE* vals, int n)
+{
+  /*  Description:
+   *    Complexity O(n) for sorted input; unsorted input is sorted first, in O(n) for int
+   *    values (radix sort), or O(n log₂(n)) otherwise.
+   *    Function replaces the BST's contents with the given values, as a perfectly balanced tree.
+   *    All nodes are allocated as one slab of the pool and filled in-order, so in-order
+   *    neighbours are also neighbours in memory. In multiset mode, equal values share a node and its count.
+   *    " _linkBalanced() " then links the block into a tree, each range's middle node being
+   *    the parent of its two halves.
+   *    
+   *  Parameters:
+   *    [struct] (BST*)  tree: A pointer to the BST.
+   *    [TYPE]   (TYPE*) vals: The values to add, in any order; left unmodified.
+   *    [int]            n   : The number of values.
+   * 
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized BST.
+   *    - Pointer 'vals' points to an array of at least 'n' elements.
+   * 
+   *  Post-conditions:
+   *    - The BST holds exactly the given values, and its height is the least possible.
+   *    - Previously held nodes are freed.
+   *    - In multiset mode, the slab's nodes left over by equal values are kept for later additions.
+   */
+
+  TYPE* sorted = vals;
+  struct Node* block;
+  int* counts = NULL;
+  int count = 0;
+  int i;
+
+  assert(tree);
+  assert(vals || n == 0);
+
+  freeBST(tree);
+
+  tree->root = NULL;
+  tree->size = n;
+
+  if (n == 0)
+    return;
+
+  /* Only unsorted input is copied and sorted */
+  for (i = 1; i < n; i++)
+  {
+
+    if ( LT(vals[i], vals[i - 1]) )
+    {
+      sorted = (TYPE*) malloc(sizeof(TYPE) * n);
+
+      assert(sorted);
+
+      for (i = 0; i < n; i++)
+        sorted[i] = vals[i];
+
+      _sortVals(sorted, n);
+
+      break;
+    }
+
+  }
+
+  block = _addSlab(tree, n);
+
+  if (tree->multiset)
+  {
+    counts = (int*) malloc(sizeof(int) * n);
+
+    assert(counts);
+  }
+
+  for (i = 0; i < n; i++)
+  {
+
+    if ( counts && count > 0 && EQ(sorted[i], block[count - 1].val) )
+    {
+      counts[count - 1]++;
+    }
+    else
+    {
+      block[count].val = sorted[i];
+
+      if (counts)
+        counts[count] = 1;
+
+      count++;
+    }
+
+  }
+
+  tree->unused = n - count;
+
+  _linkBalanced(block, counts, count, &tree->root);
+
+  if (sorted != vals)
+    free(sorted);
+
+  free(counts);
+
+}
+
+void _sortVals(TYPE* vals, int n)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Sorts the values ascending. Int values are radix sorted, 8 bits per pass, least significant
+   *    byte first; the sign bit is flipped so negative values order before positive ones. Other
+   *    value types fall back to " qsort() " with " _compareVals() ".
+   */
+
+#ifdef TYPE_INT
+  unsigned int* keys = (unsigned int*) vals;
+  unsigned int* tmp;
+  unsigned int* swap;
+  int counts[256];
+  int shift;
+  int sum;
+  int next;
+  int i;
+
+  tmp = (unsigned int*) malloc(sizeof(unsigned int) * n);
+
+  assert(tmp);
+
+  for (shift = 0; shift < 32; shift += 8)
+  {
+
+    for (i = 0; i < 256; i++)
+      counts[i] = 0;
+
+    for (i = 0; i < n; i++)
+      counts[ ((keys[i] ^ 0x80000000u) >> shift) & 0xFF ]++;
+
+    /* A pass whose byte is the same in every value would move nothing */
+    if (counts[ ((keys[0] ^ 0x80000000u) >> shift) & 0xFF ] == n)
+      continue;
+
+    for (i = 0, sum = 0; i < 256; i++)
+    {
+      next = sum + counts[i];
+      counts[i] = sum;
+      sum = next;
+    }
+
+    for (i = 0; i < n; i++)
+      tmp[ counts[ ((keys[i] ^ 0x80000000u) >> shift) & 0xFF ]++ ] = keys[i];
+
+    swap = keys;
+    keys = tmp;
+    tmp = swap;
+  }
+
+  /* An odd number of passes leaves the result in the scratch array */
+  if (keys != (unsigned int*) vals)
+  {
+
+    for (i = 0; i < n; i++)
+      tmp[i] = keys[i];
+
+    free(keys);
+  }
+  else
+  {
+    free(tmp);
+  }
+#else
+  qsort(vals, n, sizeof(TYPE), _compareVals);
+#endif
+}
+
+int _compareVals(const void* a, const void* b)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    " qsort() " comparison of two values, using LT.
+   */
+
+  if ( LT(*(const TYPE*) a, *(const TYPE*) b) )
+  {
+    return -1;
+  }
+  else if ( LT(*(const TYPE*) b, *(const TYPE*) a) )
+  {
+    return 1;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+void _linkBalanced(struct Node* block, int* counts, int count, struct Node** root)
+{
+  /*  Description:
+   *    Iterative auxiliary function.
+   *    Links an array of nodes, already in-order, into a perfectly balanced tree. Each range of
+   *    nodes still to link is kept on an explicit stack, with the child pointer it hangs from:
+   *    the range's middle node is linked there, and its two halves are stacked. Halves differ in
+   *    size by at most one, so every node's height is set from its range size alone, and the
+   *    tree is AVL-balanced.
+   *    
+   *    Subtree sizes count copies, which a node range alone does not give. Before linking, each
+   *    node's size holds the running total of copies up to itself; each stacked range carries
+   *    its own total, and the total before it, from which its halves' totals follow.
+   *    
+   *  Parameters:
+   *    [struct] (Node*)  block : The nodes, in-order, with their values set.
+   *    [int]    (int*)   counts: The copies each node holds, or NULL if every node holds one.
+   *    [int]             count : The number of nodes.
+   *    [struct] (Node**) root : Receives the tree's root.
+   * 
+   *  Post-conditions:
+   *    - Every node is linked, with correct heights and sizes.
+   */
+
+  struct Node** links[2 * BST_MAX_HEIGHT];
+  int lo[2 * BST_MAX_HEIGHT];
+  int hi[2 * BST_MAX_HEIGHT];
+  int before[2 * BST_MAX_HEIGHT];
+  int total[2 * BST_MAX_HEIGHT];
+  struct Node* node;
+  int top = 0;
+  int first;
+  int last;
+  int mid;
+  int base;
+  int sum;
+  int copies;
+  int leftTotal;
+
+  for (mid = 0, sum = 0; mid < count; mid++)
+  {
+    sum += counts ? counts[mid] : 1;
+
+    block[mid].size = sum;
+  }
+
+  links[0] = root;
+  lo[0] = 0;
+  hi[0] = count;
+  before[0] = 0;
+  total[0] = sum;
+  top = 1;
+
+  while (top > 0)
+  {
+    top--;
+
+    first = lo[top];
+    last = hi[top];
+    base = before[top];
+    sum = total[top];
+
+    if (first == last)
+    {
+      *links[top] = NULL;
+
+      continue;
+    }
+
+    mid = first + (last - first) / 2;
+    node = &block[mid];
+
+    *links[top] = node;
+
+    copies = counts ? counts[mid] : 1;
+
+    /* Copies before the middle node, less those before the range */
+    leftTotal = node->size - copies - base;
+
+    node->size = sum;
+
+    /* Height of a perfectly balanced tree of (last - first) nodes */
+    node->height = 0;
+
+    while ( (last - first) >> node->height )
+      node->height++;
+
+    links[top] = &node->left;
+    lo[top] = first;
+    hi[top] = mid;
+    total[top] = leftTotal;
+    top++;
+
+    links[top] = &node->right;
+    lo[top] = mid + 1;
+    hi[top] = last;
+    before[top] = base + leftTotal + copies;
+    total[top] = sum - leftTotal - copies;
+    top++;
+  }
+
+}
+
+struct Node* _addSlab(struct BST* tree, int capacity)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Allocates a slab of nodes in a single allocation, and makes it the pool's newest slab,
+   *    with every node unused. The nodes left unused in the previous slab are not reclaimed.
+   * 
+   *  Returns:
+   *    [struct]  (Node*): The slab's first node.
+   */
+
+  struct Slab* slab;
+
+  slab = (struct Slab*) malloc(sizeof(struct Slab) + sizeof(struct Node) * capacity);
+
+  assert(slab);
+
+  slab->next = tree->slabs;
+  slab->capacity = capacity;
+
+  tree->slabs = slab;
+  tree->unused = capacity;
+
+  return (struct Node*) (slab + 1);
+}
+
+struct Node* _newNode(struct BST* tree)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Takes a node from the pool: the most recently released one if any, else the next unused
+   *    node of the newest slab, adding a slab of BST_SLAB_NODES nodes when it is used up.
+   *    Nodes carry no allocator header, and allocating one is a few pointer moves.
+   * 
+   *  Returns:
+   *    [struct]  (Node*): The node; its fields are left to the caller.
+   */
+
+  struct Node* node;
+
+  if (tree->freeNodes)
+  {
+    node = tree->freeNodes;
+    tree->freeNodes = node->left;
+
+    return node;
+  }
+
+  if (tree->unused == 0)
+    _addSlab(tree, BST_SLAB_NODES);
+
+  node = (struct Node*) (tree->slabs + 1) + (tree->slabs->capacity - tree->unused);
+
+  tree->unused--;
+
+  return node;
+}
+
+void _freeNode(struct BST* tree, struct Node* node)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Releases a node to the pool's free list, chained through its left child pointer.
+   *    Its memory is only freed with its slab, by " freeBST() ".
+   */
+
+  node->left = tree->freeNodes;
+  tree->freeNodes = node;
+}
+
+int rankBST(struct BST* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function calls iterative function " _rankNode() " to count the values less than the given
+   *    one, using the subtree sizes kept by " _resizePath() ". In multiset mode, every copy counts.
+   *    
+   *  Parameters:
+   *    [struct] (BST*) tree: A pointer to the BST.
+   *    [TYPE]           val: The value to rank; it need not be contained.
+   * 
+   *  Returns:
+   *    [int]     The number of values less than 'val'; also the index 'val' has, or would have, in-order.
+   * 
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The BST is correctly linked.
+   */
+
+  assert(tree);
+
+  return _rankNode(tree->root, val, 0);
+}
+
+int selectBST(struct BST* tree, int k, TYPE* out)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function finds the k-th smallest value, counting from 0, by descending towards the subtree
+   *    whose size range holds k. In multiset mode, every copy counts.
+   *    
+   *  Parameters:
+   *    [struct] (BST*)  tree: A pointer to the BST.
+   *    [int]            k   : The in-order index of the value.
+   *    [TYPE]   (TYPE*) out : Receives the value.
+   * 
+   *  Returns:
+   *    [int]     (1 || 0): True if the index is within the BST's size, False if not.
+   * 
+   *  Pre-conditions:
+   *    - Pointers 'tree' and 'out' point to proper memory locations.
+   *    - The BST is correctly linked.
+   * 
+   *  Post-conditions:
+   *    - If True (1) is returned, the value is written to 'out'; otherwise 'out' is untouched.
+   */
+
+  struct Node* curr;
+  int left;
+
+  assert(tree);
+  assert(out);
+
+  curr = tree->root;
+
+  while (curr)
+  {
+    left = _sizeNode(curr->left);
+
+    if (k < left)
+    {
+      curr = curr->left;
+    }
+    else if (k < curr->size - _sizeNode(curr->right))
+    {
+      *out = curr->val;
+
+      return 1;
+    }
+    else
+    {
+      k -= curr->size - _sizeNode(curr->right);
+
+      curr = curr->right;
+    }
+
+  }
+
+  return 0;
+}
+
+int countRangeBST(struct BST* tree, TYPE lo, TYPE hi)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function counts the values between 'lo' and 'hi', both included, as the difference of two
+   *    ranks. In multiset mode, every copy counts.
+   *    
+   *  Parameters:
+   *    [struct] (BST*) tree: A pointer to the BST.
+   *    [TYPE]           lo : The lower bound.
+   *    [TYPE]           hi : The upper bound.
+   * 
+   *  Returns:
+   *    [int]     The number of values in the range; 0 if 'hi' is less than 'lo'.
+   * 
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The BST is correctly linked.
+   */
+
+  assert(tree);
+
+  if ( LT(hi, lo) )
+    return 0;
+
+  return _rankNode(tree->root, hi, 1) - _rankNode(tree->root, lo, 0);
+}
+
+int floorBST(struct BST* tree, TYPE val, TYPE* out)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function finds the greatest value not greater than the given one: the value ranked just
+   *    before every value greater than 'val'.
+   *    
+   *  Parameters:
+   *    [struct] (BST*)  tree: A pointer to the BST.
+   *    [TYPE]           val : The value to search from.
+   *    [TYPE]   (TYPE*) out : Receives the value found.
+   * 
+   *  Returns:
+   *    [int]     (1 || 0): True if such a value exists, False if not.
+   * 
+   *  Pre-conditions:
+   *    - Pointers 'tree' and 'out' point to proper memory locations.
+   *    - The BST is correctly linked.
+   */
+
+  assert(tree);
+
+  return selectBST(tree, _rankNode(tree->root, val, 1) - 1, out);
+}
+
+int ceilingBST(struct BST* tree, TYPE val, TYPE* out)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function finds the least value not less than the given one: the value ranked just after
+   *    every value less than 'val'. Mirror of " floorBST() ".
+   *    
+   *  Returns:
+   *    [int]     (1 || 0): True if such a value exists, False if not.
+   */
+
+  assert(tree);
+
+  return selectBST(tree, _rankNode(tree->root, val, 0), out);
+}
+
+int predecessorBST(struct BST* tree, TYPE val, TYPE* out)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function finds the greatest value strictly less than the given one. Like " floorBST() ",
+   *    but a value equal to 'val' is skipped.
+   *    
+   *  Returns:
+   *    [int]     (1 || 0): True if such a value exists, False if not.
+   */
+
+  assert(tree);
+
+  return selectBST(tree, _rankNode(tree->root, val, 0) - 1, out);
+}
+
+int successorBST(struct BST* tree, TYPE val, TYPE* out)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function finds the least value strictly greater than the given one. Like " ceilingBST() ",
+   *    but a value equal to 'val' is skipped.
+   *    
+   *  Returns:
+   *    [int]     (1 || 0): True if such a value exists, False if not.
+   */
+
+  assert(tree);
+
+  return selectBST(tree, _rankNode(tree->root, val, 1), out);
+}
+
+int _rankNode(struct Node* curr, TYPE val, int inclusive)
+{
+  /*  Description:
+   *    Iterative auxiliary function.
+   *    Traverses the BST using binary search. Whenever the search moves right, the current node's
+   *    copies and its whole left subtree are less than (or equal to) the given value, and are counted.
+   *    
+   *  Parameters:
+   *    [struct] (Node*) curr     : A pointer to the node to traverse from.
+   *    [TYPE]           val      : The value to rank.
+   *    [int]            inclusive: If True (1), values equal to 'val' are counted too.
+   * 
+   *  Returns:
+   *    [int]     The number of values less than (or equal to) 'val'.
+   */
+
+  int rank = 0;
+
+  while (curr)
+  {
+
+    if ( LT(curr->val, val) || (inclusive && EQ(curr->val, val)) )
+    {
+      rank += curr->size - _sizeNode(curr->right);
+
+      curr = curr->right;
+    }
+    else
+    {
+      curr = curr->left;
+    }
+
+  }
+
+  return rank;
+}
+
+void unionBST(struct BST* tree, struct BST* other)
+{
+  /*  Description:
+   *    Complexity O(m log₂(n / m + 1)), for trees of sizes m <= n.
+   *    Function merges the other BST into this one, by splitting and joining subtrees
+   *    (" _unionNodes() ") rather than adding values one at a time. In multiset mode, the counts
+   *    of a value contained in both are added. The other BST's nodes are moved, not copied.
+   *    
+   *  Parameters:
+   *    [struct] (BST*) tree : A pointer to the BST receiving the result.
+   *    [struct] (BST*) other: A pointer to the BST to merge in.
+   * 
+   *  Pre-conditions:
+   *    - Pointers 'tree' and 'other' point to two different, correctly linked BSTs.
+   *    - Outside multiset mode, neither BST holds a value twice (see " insertUniqueBST() ").
+   * 
+   *  Post-conditions:
+   *    - The BST holds every value of either BST, and the other BST is empty.
+   */
+
+  assert(tree);
+  assert(other);
+  assert(tree != other);
+
+  _adoptPool(tree, other);
+
+  tree->root = _unionNodes(tree, tree->root, other->root);
+  tree->size = _sizeNode(tree->root);
+
+  other->root = NULL;
+  other->size = 0;
+}
+
+void intersectBST(struct BST* tree, struct BST* other)
+{
+  /*  Description:
+   *    Complexity O(m log₂(n / m + 1)), for trees of sizes m <= n, plus the nodes released.
+   *    Function keeps only the values also contained in the other BST, by splitting and joining
+   *    subtrees (" _intersectNodes() "). In multiset mode, a value keeps the lesser of its counts.
+   *    
+   *  Parameters:
+   *    [struct] (BST*) tree : A pointer to the BST receiving the result.
+   *    [struct] (BST*) other: A pointer to the BST to intersect with.
+   * 
+   *  Pre-conditions:
+   *    - Pointers 'tree' and 'other' point to two different, correctly linked BSTs.
+   *    - Outside multiset mode, neither BST holds a value twice.
+   * 
+   *  Post-conditions:
+   *    - The BST holds the values contained in both BSTs, and the other BST is empty.
+   */
+
+  assert(tree);
+  assert(other);
+  assert(tree != other);
+
+  _adoptPool(tree, other);
+
+  tree->root = _intersectNodes(tree, tree->root, other->root);
+  tree->size = _sizeNode(tree->root);
+
+  other->root = NULL;
+  other->size = 0;
+}
+
+void differenceBST(struct BST* tree, struct BST* other)
+{
+  /*  Description:
+   *    Complexity O(m log₂(n / m + 1)), for trees of sizes m <= n, plus the nodes released.
+   *    Function removes every value contained in the other BST, by splitting and joining
+   *    subtrees (" _differenceNodes() "). In multiset mode, a value's count is reduced by the
+   *    other's count, and the value is removed once none is left.
+   *    
+   *  Parameters:
+   *    [struct] (BST*) tree : A pointer to the BST receiving the result.
+   *    [struct] (BST*) other: A pointer to the BST of values to remove.
+   * 
+   *  Pre-conditions:
+   *    - Pointers 'tree' and 'other' point to two different, correctly linked BSTs.
+   *    - Outside multiset mode, neither BST holds a value twice.
+   * 
+   *  Post-conditions:
+   *    - The BST holds its values not contained in the other BST, and the other BST is empty.
+   */
+
+  assert(tree);
+  assert(other);
+  assert(tree != other);
+
+  _adoptPool(tree, other);
+
+  tree->root = _differenceNodes(tree, tree->root, other->root);
+  tree->size = _sizeNode(tree->root);
+
+  other->root = NULL;
+  other->size = 0;
+}
+
+struct Node* _unionNodes(struct BST* tree, struct Node* curr, struct Node* other)
+{
+  /*  Description:
+   *    Recursive auxiliary function; the recursion only follows the first tree's height.
+   *    Splits the other subtree around the current node's value, merges each side into the
+   *    matching child subtree, and joins both results back through the current node.
+   *    A node of the other subtree with the same value is released, its copies merged.
+   *    
+   *  Returns:
+   *    [struct]  (Node*): The root of the merged subtree.
+   */
+
+  struct Node* left;
+  struct Node* right;
+  struct Node* found;
+  int count;
+  int foundCount;
+
+  if (curr == NULL)
+    return other;
+
+  if (other == NULL)
+    return curr;
+
+  count = _countNode(curr);
+
+  _splitNodes(other, curr->val, &left, &found, &foundCount, &right);
+
+  left = _unionNodes(tree, curr->left, left);
+  right = _unionNodes(tree, curr->right, right);
+
+  if (found)
+  {
+
+    if (tree->multiset)
+      count += foundCount;
+
+    _freeNode(tree, found);
+  }
+
+  return _joinNodes(left, curr, count, right);
+}
+
+struct Node* _intersectNodes(struct BST* tree, struct Node* curr, struct Node* other)
+{
+  /*  Description:
+   *    Recursive auxiliary function; the recursion only follows the first tree's height.
+   *    Splits the other subtree around the current node's value, and intersects each side with
+   *    the matching child subtree. The current node is kept, and joins both results, only if
+   *    the other subtree held its value; otherwise the results are joined without it.
+   *    
+   *  Returns:
+   *    [struct]  (Node*): The root of the intersected subtree.
+   */
+
+  struct Node* left;
+  struct Node* right;
+  struct Node* found;
+  int count;
+  int foundCount;
+
+  if (curr == NULL || other == NULL)
+  {
+    _freeSubtree(tree, curr);
+    _freeSubtree(tree, other);
+
+    return NULL;
+  }
+
+  count = _countNode(curr);
+
+  _splitNodes(other, curr->val, &left, &found, &foundCount, &right);
+
+  left = _intersectNodes(tree, curr->left, left);
+  right = _intersectNodes(tree, curr->right, right);
+
+  if (found)
+  {
+
+    if (foundCount < count)
+      count = foundCount;
+
+    _freeNode(tree, found);
+
+    return _joinNodes(left, curr, count, right);
+  }
+
+  _freeNode(tree, curr);
+
+  return _joinPair(left, right);
+}
+
+struct Node* _differenceNodes(struct BST* tree, struct Node* curr, struct Node* other)
+{
+  /*  Description:
+   *    Recursive auxiliary function; the recursion only follows the first tree's height.
+   *    Splits the other subtree around the current node's value, and subtracts each side from
+   *    the matching child subtree. The current node is dropped if the other subtree held its
+   *    value (and, in multiset mode, at least as many copies).
+   *    
+   *  Returns:
+   *    [struct]  (Node*): The root of the remaining subtree.
+   */
+
+  struct Node* left;
+  struct Node* right;
+  struct Node* found;
+  int count;
+  int foundCount;
+
+  if (curr == NULL || other == NULL)
+  {
+    _freeSubtree(tree, other);
+
+    return curr;
+  }
+
+  count = _countNode(curr);
+
+  _splitNodes(other, curr->val, &left, &found, &foundCount, &right);
+
+  left = _differenceNodes(tree, curr->left, left);
+  right = _differenceNodes(tree, curr->right, right);
+
+  if (found)
+  {
+
+    if (foundCount < count)
+    {
+      _freeNode(tree, found);
+
+      return _joinNodes(left, curr, count - foundCount, right);
+    }
+
+    _freeNode(tree, found);
+    _freeNode(tree, curr);
+
+    return _joinPair(left, right);
+  }
+
+  return _joinNodes(left, curr, count, right);
+}
+
+void _splitNodes(struct Node* curr, TYPE val, struct Node** left, struct Node** found, int* foundCount, struct Node** right)
+{
+  /*  Description:
+   *    Iterative auxiliary function.
+   *    Splits a subtree around a value: descends to the value, recording the path, then retraces
+   *    it, joining each ancestor (and its other subtree) onto the side it belongs to. Joins
+   *    along the path cost O(log₂(n)) in total, since each one's cost is the height difference.
+   *    
+   *  Parameters:
+   *    [struct] (Node*)  curr      : The subtree to split; its nodes are all reused.
+   *    [TYPE]            val       : The value to split around.
+   *    [struct] (Node**) left      : Receives the subtree of values less than 'val'.
+   *    [struct] (Node**) found     : Receives the node with the value, detached, or NULL.
+   *    [int]    (int*)   foundCount: Receives the copies the found node holds, if any.
+   *    [struct] (Node**) right     : Receives the subtree of values greater than 'val'.
+   */
+
+  struct Node* path[BST_MAX_HEIGHT];
+  int counts[BST_MAX_HEIGHT];
+  struct Node* node;
+  int depth = 0;
+
+  /* Copies are taken on the way down, while the sizes they derive from are intact */
+  while ( curr && !EQ(val, curr->val) )
+  {
+    counts[depth] = _countNode(curr);
+    path[depth++] = curr;
+
+    curr = LT(val, curr->val) ? curr->left : curr->right;
+  }
+
+  *found = curr;
+  *foundCount = curr ? _countNode(curr) : 0;
+  *left = curr ? curr->left : NULL;
+  *right = curr ? curr->right : NULL;
+
+  while (depth > 0)
+  {
+    node = path[--depth];
+
+    if ( LT(val, node->val) )
+    {
+      *right = _joinNodes(*right, node, counts[depth], node->right);
+    }
+    else
+    {
+      *left = _joinNodes(node->left, node, counts[depth], *left);
+    }
+
+  }
+
+}
+
+struct Node* _joinNodes(struct Node* left, struct Node* mid, int count, struct Node* right)
+{
+  /*  Description:
+   *    Iterative auxiliary function.
+   *    Joins two AVL subtrees through a middle node, all of 'left' ordering before it and all
+   *    of 'right' after. If their heights differ by more than one, the middle node descends the
+   *    taller subtree's inner spine to the first subtree no more than one taller than the shorter
+   *    one, takes it and the shorter subtree as children, and takes its place; the spine's sizes
+   *    grow by the middle node's copies and the shorter subtree, and it is then retraced, as after
+   *    an insertion.
+   *    
+   *  Parameters:
+   *    [struct] (Node*) left : The subtree ordering before the middle node, or NULL.
+   *    [struct] (Node*) mid  : The middle node, detached; its links and size are overwritten.
+   *    [int]            count: The copies the middle node is to hold.
+   *    [struct] (Node*) right: The subtree ordering after the middle node, or NULL.
+   * 
+   *  Returns:
+   *    [struct]  (Node*): The joined subtree's root.
+   */
+
+  struct Node** path[BST_MAX_HEIGHT];
+  struct Node** link;
+  struct Node* root;
+  int depth = 0;
+
+  if ( _heightNode(left) > _heightNode(right) + 1 )
+  {
+    root = left;
+    link = &root;
+
+    while ( _heightNode(*link) > _heightNode(right) + 1 )
+    {
+      path[depth++] = link;
+      link = &(*link)->right;
+    }
+
+    mid->left = *link;
+    mid->right = right;
+  }
+  else if ( _heightNode(right) > _heightNode(left) + 1 )
+  {
+    root = right;
+    link = &root;
+
+    while ( _heightNode(*link) > _heightNode(left) + 1 )
+    {
+      path[depth++] = link;
+      link = &(*link)->left;
+    }
+
+    mid->left = left;
+    mid->right = *link;
+  }
+  else
+  {
+    root = mid;
+    link = &root;
+
+    mid->left = left;
+    mid->right = right;
+  }
+
+  mid->size = count + _sizeNode(mid->left) + _sizeNode(mid->right);
+
+  _updateHeight(mid);
+
+  _resizePath(path, depth, mid->size - _sizeNode(*link));
+
+  *link = mid;
+
+  _retracePath(path, depth);
+
+  return root;
+}
+
+struct Node* _joinPair(struct Node* left, struct Node* right)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Joins two AVL subtrees, all of 'left' ordering before 'right', with no middle node:
+   *    the leftmost node of 'right' is unlinked and used as one.
+   *    
+   *  Returns:
+   *    [struct]  (Node*): The joined subtree's root.
+   */
+
+  struct Node** path[BST_MAX_HEIGHT];
+  struct Node* mid;
+  int depth = 0;
+  int count;
+
+  if (right == NULL)
+    return left;
+
+  mid = _removeLeftmost(&right, path, &depth);
+  count = _countNode(mid);
+
+  _resizePath(path, depth, -count);
+  _retracePath(path, depth);
+
+  return _joinNodes(left, mid, count, right);
+}
+
+void _freeSubtree(struct BST* tree, struct Node* curr)
+{
+  /*  Description:
+   *    Iterative auxiliary function.
+   *    Releases every node of a subtree to the pool, depth-first with an explicit stack.
+   */
+
+  struct Node* stack[2 * BST_MAX_HEIGHT];
+  int top = 0;
+
+  if (curr)
+    stack[top++] = curr;
+
+  while (top > 0)
+  {
+    curr = stack[--top];
+
+    if (curr->left)
+      stack[top++] = curr->left;
+
+    if (curr->right)
+      stack[top++] = curr->right;
+
+    _freeNode(tree, curr);
+  }
+
+}
+
+void _adoptPool(struct BST* tree, struct BST* other)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Moves the other BST's node pool into this one, so its nodes can be linked into this BST:
+   *    its slabs are spliced in behind this pool's newest slab, and its free and unused nodes
+   *    are released to this pool's free list.
+   * 
+   *  Post-conditions:
+   *    - The other BST's pool is empty; its nodes are still linked, but owned by this BST.
+   */
+
+  struct Slab* last;
+
+  while (other->freeNodes || other->unused > 0)
+    _freeNode(tree, _newNode(other));
+
+  if (other->slabs)
+  {
+
+    if (tree->slabs)
+    {
+
+      for (last = other->slabs; last->next; last = last->next)
+        ;
+
+      last->next = tree->slabs->next;
+      tree->slabs->next = other->slabs;
+    }
+    else
+    {
+      tree->slabs = other->slabs;
+      tree->unused = 0;
+    }
+
+  }
+
+  other->slabs = NULL;
+}
+
+int saveBST(struct BST* tree, const char* fileName)
+{
+  /*  Description:
+   *    Complexity O(n).
+   *    Function writes the BST to a binary file: a header, then every node's value in-order,
+   *    then (in multiset mode) every node's count. The values are sorted, so " loadBST() "
+   *    rebuilds a balanced tree from them without comparing or parsing anything.
+   *    
+   *    File layout, in the machine's byte order:
+   *    
+   *    [ BST_MAGIC | sizeof(TYPE) | nodes | multiset ] [ vals: nodes ] [ counts: nodes, multiset only ]
+   *    
+   *  Parameters:
+   *    [struct] (BST*) tree    : A pointer to the BST.
+   *    [char]   (char*) fileName: The file to write.
+   * 
+   *  Returns:
+   *    [int]     (1 || 0): True if the file was written, False if not.
+   * 
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The BST is correctly linked.
+   */
+
+  struct Node* stack[BST_MAX_HEIGHT];
+  struct Node* curr;
+  unsigned int header[4];
+  TYPE* vals;
+  int* counts;
+  FILE* file;
+  int nodes = 0;
+  int top = 0;
+  int ok;
+
+  assert(tree);
+
+  vals = (TYPE*) malloc(sizeof(TYPE) * (tree->size + 1));
+  counts = (int*) malloc(sizeof(int) * (tree->size + 1));
+
+  assert(vals);
+  assert(counts);
+
+  curr = tree->root;
+
+  while (curr || top > 0)
+  {
+
+    while (curr)
+    {
+      stack[top++] = curr;
+      curr = curr->left;
+    }
+
+    curr = stack[--top];
+
+    vals[nodes] = curr->val;
+    counts[nodes] = _countNode(curr);
+    nodes++;
+
+    curr = curr->right;
+  }
+
+  header[0] = BST_MAGIC;
+  header[1] = (unsigned int) sizeof(TYPE);
+  header[2] = (unsigned int) nodes;
+  header[3] = (unsigned int) tree->multiset;
+
+  file = fopen(fileName, "wb");
+
+  if (file)
+  {
+    ok = fwrite(header, sizeof(header), 1, file) == 1
+      && fwrite(vals, sizeof(TYPE), nodes, file) == (size_t) nodes
+      && ( !tree->multiset || fwrite(counts, sizeof(int), nodes, file) == (size_t) nodes );
+
+    ok = (fclose(file) == 0) && ok;
+  }
+  else
+  {
+    ok = 0;
+  }
+
+  free(vals);
+  free(counts);
+
+  return ok;
+}
+
+int loadBST(struct BST* tree, const char* fileName)
+{
+  /*  Description:
+   *    Complexity O(n).
+   *    Function replaces the BST's contents with a file written by " saveBST() ". The values and
+   *    counts are each taken in one sequential read, copied into a single slab of nodes, and
+   *    linked by " _linkBalanced() ", as in " buildBST() ". The header is checked against the
+   *    file's length before anything is allocated, and the values must be strictly ascending
+   *    with counts that fit in the tree's size, so a damaged file cannot produce a malformed tree.
+   *    
+   *  Parameters:
+   *    [struct] (BST*) tree    : A pointer to the BST.
+   *    [char]   (char*) fileName: The file to read.
+   * 
+   *  Returns:
+   *    [int]     (1 || 0): True if the file was loaded, False if it could not be read or is not valid.
+   * 
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized BST.
+   * 
+   *  Post-conditions:
+   *    - On success, the BST holds the saved values and mode, and its height is the least possible.
+   *    - On failure, the BST is empty.
+   */
+
+  struct Node* block;
+  unsigned int header[4];
+  TYPE* vals = NULL;
+  int* counts = NULL;
+  FILE* file;
+  unsigned long bytes;
+  unsigned long width;
+  long start;
+  long end;
+  int nodes;
+  int total = 0;
+  int ok;
+  int i;
+
+  assert(tree);
+
+  freeBST(tree);
+
+  file = fopen(fileName, "rb");
+
+  if (!file)
+    return 0;
+
+  if ( fread(header, sizeof(header), 1, file) != 1 || header[0] != BST_MAGIC
+       || header[1] != sizeof(TYPE) || header[2] > (unsigned int) BST_MAX_SIZE )
+  {
+    fclose(file);
+    return 0;
+  }
+
+  nodes = (int) header[2];
+  width = sizeof(TYPE) + (header[3] != 0 ? sizeof(int) : 0);
+
+  /* The rest of the file must be exactly the values (and counts) the header promises */
+  if ( (unsigned long) nodes > ((unsigned long) -1) / width )
+  {
+    fclose(file);
+    return 0;
+  }
+
+  bytes = (unsigned long) nodes * width;
+
+  start = ftell(file);
+
+  if ( start < 0 || fseek(file, 0, SEEK_END) != 0 || (end = ftell(file)) < start
+       || (unsigned long)(end - start) != bytes || fseek(file, start, SEEK_SET) != 0 )
+  {
+    fclose(file);
+    return 0;
+  }
+
+  tree->multiset = (header[3] != 0);
+
+  vals = (TYPE*) malloc(sizeof(TYPE) * (nodes > 0 ? (size_t) nodes : 1));
+  counts = (int*) malloc(sizeof(int) * (nodes > 0 ? (size_t) nodes : 1));
+
+  if (vals == NULL || counts == NULL)
+  {
+    free(vals);
+    free(counts);
+    fclose(file);
+    return 0;
+  }
+
+  ok = fread(vals, sizeof(TYPE), nodes, file) == (size_t) nodes
+    && ( !tree->multiset || fread(counts, sizeof(int), nodes, file) == (size_t) nodes );
+
+  fclose(file);
+
+  for (i = 0; ok && i < nodes; i++)
+  {
+
+    if ( !tree->multiset )
+      counts[i] = 1;
+
+    if ( counts[i] < 1 || counts[i] > BST_MAX_SIZE - total || (i > 0 && !LT(vals[i - 1], vals[i])) )
+      ok = 0;
+    else
+      total += counts[i];
+
+  }
+
+  if (ok && nodes > 0)
+  {
+    block = _addSlab(tree, nodes);
+
+    for (i = 0; i < nodes; i++)
+      block[i].val = vals[i];
+
+    tree->unused = 0;
+
+    _linkBalanced(block, tree->multiset ? counts : NULL, nodes, &tree->root);
+
+    tree->size = _sizeNode(tree->root);
+  }
+
+  free(vals);
+  free(counts);
+
+  return ok;
+}
+
+void shapeBST(struct BST* tree, struct BSTShape* shape)
+{
+  /*  Description:
+   *    Complexity O(n).
+   *    Function measures the shape of the BST: its height, the depth of every node, and its
+   *    greatest balance factor. The walk is iterative, over an explicit stack of nodes and
+   *    their depths, so measuring a degenerate tree cannot overflow the call stack.
+   *    
+   *  Parameters:
+   *    [struct] (BST*)      tree : A pointer to the BST.
+   *    [struct] (BSTShape*) shape: A pointer to the report to fill.
+   * 
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized BST.
+   *    - Pointer 'shape' is not NULL.
+   * 
+   *  Post-conditions:
+   *    - The report describes the BST as it stands; an empty BST has no nodes and height 0.
+   */
+
+  struct Node* stack[BST_MAX_HEIGHT + 1];
+  int depthOf[BST_MAX_HEIGHT + 1];
+  struct Node* curr;
+  double depthSum = 0;
+  int top = 0;
+  int depth;
+  int skew;
+  int i;
+
+  assert(tree);
+  assert(shape);
+
+  shape->nodes = 0;
+  shape->height = 0;
+  shape->minHeight = 0;
+  shape->maxImbalance = 0;
+  shape->averageDepth = 0;
+
+  for (i = 0; i < BST_MAX_HEIGHT; i++)
+    shape->depths[i] = 0;
+
+  if (tree->root)
+  {
+    stack[top] = tree->root;
+    depthOf[top++] = 1;
+  }
+
+  /* Pre-order: each node is popped once, pushing its right child below its left */
+  while (top > 0)
+  {
+    curr = stack[--top];
+    depth = depthOf[top];
+
+    shape->nodes++;
+    shape->depths[depth - 1]++;
+    depthSum += depth;
+
+    if (depth > shape->height)
+      shape->height = depth;
+
+    skew = _heightNode(curr->left) - _heightNode(curr->right);
+
+    if (skew < 0)
+      skew = -skew;
+
+    if (skew > shape->maxImbalance)
+      shape->maxImbalance = skew;
+
+    if (curr->right)
+    {
+      stack[top] = curr->right;
+      depthOf[top++] = depth + 1;
+    }
+
+    if (curr->left)
+    {
+      stack[top] = curr->left;
+      depthOf[top++] = depth + 1;
+    }
+
+  }
+
+  if (shape->nodes > 0)
+    shape->averageDepth = depthSum / shape->nodes;
+
+  /* Least height h such that 2^h - 1 >= nodes */
+  while ( ((1L << shape->minHeight) - 1) < shape->nodes )
+    shape->minHeight++;
+}
+
+void dumpShapeBST(struct BST* tree, FILE* file)
+{
+  /*  Description:
+   *    Complexity O(n).
+   *    Function writes the BST's shape report as one JSON object: the figures of " shapeBST() ",
+   *    the node count at every depth, and, when built with -DBST_STATS, the calls and comparisons
+   *    counted for each operation, with their mean.
+   *    
+   *  Parameters:
+   *    [struct] (BST*)  tree: A pointer to the BST.
+   *    [FILE]   (FILE*) file: The stream to write to.
+   * 
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized BST.
+   *    - Pointer 'file' is open for writing.
+   * 
+   *  Post-conditions:
+   *    - One line of JSON is written to the stream.
+   */
+
+  struct BSTShape shape;
+  int i;
+
+# ifdef BST_STATS
+  const char* names[3] = { "contains", "add", "remove" };
+  long calls;
+# endif
+
+  assert(file);
+
+  shapeBST(tree, &shape);
+
+  fprintf(file, "{\"size\": %d, \"nodes\": %d, \"height\": %d, \"minHeight\": %d, ",
+          tree->size, shape.nodes, shape.height, shape.minHeight);
+
+  fprintf(file, "\"heightRatio\": %.3f, \"maxImbalance\": %d, \"averageDepth\": %.3f, ",
+          shape.minHeight ? (double) shape.height / shape.minHeight : 0.0,
+          shape.maxImbalance, shape.averageDepth);
+
+  fprintf(file, "\"depths\": [");
+
+  for (i = 0; i < shape.height; i++)
+    fprintf(file, "%s%d", i ? ", " : "", shape.depths[i]);
+
+  fprintf(file, "]");
+
+# ifdef BST_STATS
+  fprintf(file, ", \"stats\": {");
+
+  for (i = 0; i < 3; i++)
+  {
+    calls = tree->stats.calls[i];
+
+    fprintf(file, "%s\"%s\": {\"calls\": %ld, \"compares\": %ld, \"comparesPerCall\": %.3f}",
+            i ? ", " : "", names[i], calls, tree->stats.compares[i],
+            calls ? (double) tree->stats.compares[i] / calls : 0.0);
+  }
+
+  fprintf(file, "}");
+# endif
+
+  fprintf(file, "}\n");
+}
+
+void resetStatsBST(struct BST* tree)
+{
+  /*  Description:
+   *    Complexity O(1).
+   *    Function zeroes the BST's comparison counters. Without -DBST_STATS there are none,
+   *    and it does nothing.
+   *    
+   *  Parameters:
+   *    [struct] (BST*) tree: A pointer to the BST.
+   * 
+   *  Pre-conditions:
+   *    - Pointer 'tree' is not NULL.
+   * 
+   *  Post-conditions:
+   *    - Every operation's calls and comparisons are 0.
+   */
+
+  assert(tree);
+
+# ifdef BST_STATS
+  {
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+      tree->stats.calls[i] = 0;
+      tree->stats.compares[i] = 0;
+    }
+  }
+# endif
+}
+
+void containsManyBST(struct BST* tree, TYPE* vals, int n, int* out)
+{
+  /*  Description:
+   *    Complexity O(n log₂(m)), for m nodes, and far less for sorted, clustered values.
+   *    Function answers " containsBST() " for a whole batch of values, in one of two ways:
+   *    
+   *    - Sorted values   -> one merged descent, " _containsSorted() ": each search resumes
+   *                         where the previous one's path can still lead, instead of at the root.
+   *    - Any other order -> interleaved searches, " _containsInterleaved() ": BST_PROBE_BATCH
+   *                         searches advance a level at a time, so their cache misses overlap.
+   *    
+   *    Sorting unsorted values first would cost more than the merged descent saves on them,
+   *    unless the batch is very large and dense; so only an already sorted batch is merged.
+   *    
+   *  Parameters:
+   *    [struct] (BST*)  tree: A pointer to the BST.
+   *    [TYPE]   (TYPE*) vals: The values to search for.
+   *    [int]            n   : The number of values.
+   *    [int]    (int*)  out : Receives True (1) or False (0) for each value.
+   * 
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized BST.
+   *    - Pointers 'vals' and 'out' point to arrays of at least 'n' elements.
+   * 
+   *  Post-conditions:
+   *    - out[i] is True (1) if vals[i] is contained, or False (0) if not.
+   */
+
+  int i;
+
+  assert(tree);
+  assert( (vals && out) || n == 0 );
+
+  for (i = 1; i < n; i++)
+  {
+
+    if ( LT(vals[i], vals[i - 1]) )
+      break;
+
+  }
+
+  if (i >= n)
+    _containsSorted(tree, vals, n, out);
+  else
+    _containsInterleaved(tree, vals, n, out);
+
+}
+
+void _containsSorted(struct BST* tree, TYPE* vals, int n, int* out)
+{
+  /*  Description:
+   *    Iterative auxiliary function.
+   *    Searches for ascending values in one merged descent. Each search resumes from the deepest
+   *    node of the previous search's path that can still lead to its value: a path prefix shared
+   *    by consecutive values is walked once, and a subtree no value falls into is never entered.
+   *    The path is kept on an explicit stack, each node with its bound: its nearest ancestor
+   *    whose left subtree it is in. Values only increase, so a node still leads to the next value
+   *    exactly when the value is less than its bound's; the others are popped.
+   *    
+   *  Parameters:
+   *    [struct] (BST*)  tree: A pointer to the BST.
+   *    [TYPE]   (TYPE*) vals: The values to search for, in ascending order.
+   *    [int]            n   : The number of values.
+   *    [int]    (int*)  out : Receives True (1) or False (0) for each value.
+   */
+
+  struct Node* path[BST_MAX_HEIGHT];
+  struct Node* bound[BST_MAX_HEIGHT];
+  struct Node* curr;
+  struct Node* above;
+  int depth = 0;
+  int i;
+
+  for (i = 0; i < n; i++)
+  {
+    BST_CALL(tree, BST_OP_CONTAINS);
+
+    /* Pop the nodes whose subtree lies wholly below the value */
+    while ( depth > 0 && bound[depth - 1] && !LT(vals[i], bound[depth - 1]->val) )
+      depth--;
+
+    if (depth > 0)
+    {
+      depth--;
+
+      curr = path[depth];
+      above = bound[depth];
+    }
+    else
+    {
+      curr = tree->root;
+      above = NULL;
+    }
+
+    out[i] = 0;
+
+    while (curr)
+    {
+      BST_COMPARE(tree, BST_OP_CONTAINS, 1);
+
+      path[depth] = curr;
+      bound[depth++] = above;
+
+      if ( EQ(vals[i], curr->val) )
+      {
+        out[i] = 1;
+
+        break;
+      }
+
+      if ( LT(vals[i], curr->val) )
+      {
+        above = curr;
+        curr = curr->left;
+      }
+      else
+      {
+        curr = curr->right;
+      }
+
+    }
+
+  }
+
+}
+
+void _containsInterleaved(struct BST* tree, TYPE* vals, int n, int* out)
+{
+  /*  Description:
+   *    Iterative auxiliary function.
+   *    Runs the searches BST_PROBE_BATCH at a time, in lockstep, as " containsManyFrozenBST() "
+   *    does on a snapshot: every search of the batch takes one step down before any takes the
+   *    next. One search's next node depends on the node it is waiting for, but the batch's
+   *    searches are independent, so their cache misses are served together.
+   *    
+   *  Parameters:
+   *    [struct] (BST*)  tree: A pointer to the BST.
+   *    [TYPE]   (TYPE*) vals: The values to search for.
+   *    [int]            n   : The number of values.
+   *    [int]    (int*)  out : Receives True (1) or False (0) for each value.
+   */
+
+  struct Node* curr[BST_PROBE_BATCH];
+  int active;
+  int batch;
+  int i;
+  int j;
+
+  for (i = 0; i < n; i += BST_PROBE_BATCH)
+  {
+    batch = (n - i < BST_PROBE_BATCH) ? (n - i) : BST_PROBE_BATCH;
+
+    for (j = 0; j < batch; j++)
+    {
+      BST_CALL(tree, BST_OP_CONTAINS);
+
+      curr[j] = tree->root;
+      out[i + j] = 0;
+    }
+
+    for (active = batch; active > 0; )
+    {
+      active = 0;
+
+      for (j = 0; j < batch; j++)
+      {
+
+        if (curr[j] == NULL)
+          continue;
+
+        BST_COMPARE(tree, BST_OP_CONTAINS, 1);
+
+        if ( EQ(vals[i + j], curr[j]->val) )
+        {
+          out[i + j] = 1;
+          curr[j] = NULL;
+
+          continue;
+        }
+
+        if ( LT(vals[i + j], curr[j]->val) )
+          curr[j] = curr[j]->left;
+        else
+          curr[j] = curr[j]->right;
+
+        if (curr[j])
+          active++;
+
+      }
+
+    }
+
+  }
+
 }
@@ -1,3 +1,4 @@
+#include <stdio.h>
 #include "structs.h"
 
 #ifndef __INTERFACES_H
@@ -5,18 +6,75 @@
 
 /* Binary Search Tree */
 void initBST(struct BST* tree);
+void initMultisetBST(struct BST* tree);
 void freeBST(struct BST* tree);
 int containsBST(struct BST* tree, TYPE val);
 void addBST(struct BST* tree, TYPE val);
-void removeBST(struct BST* tree, TYPE val);
+int insertUniqueBST(struct BST* tree, TYPE val);
+int removeBST(struct BST* tree, TYPE val);
 void printBST(struct BST* tree);
 int isEmptyBST(struct BST* tree);
-struct Node* _addNode(struct Node* curr, TYPE val);
-struct Node* _removeNode(struct Node* curr, TYPE val);
-struct Node *_removeLeftmost(struct Node* curr);
-int _containsNode(struct Node* curr, TYPE val);
+int _addNode(struct BST* tree, struct Node** link, TYPE val, int mode);
+int _removeNode(struct BST* tree, struct Node** link, TYPE val);
+struct Node* _removeLeftmost(struct Node** link, struct Node** path[], int* depth);
+int _containsNode(struct BST* tree, struct Node* curr, TYPE val);
 void _printInOrder(struct Node* curr);
-void _freePostOrder(struct Node* curr);
+void _retracePath(struct Node** path[], int depth);
+void _resizePath(struct Node** path[], int depth, int delta);
+int _sizeNode(struct Node* curr);
+int _countNode(struct Node* curr);
+int _heightNode(struct Node* curr);
+void _updateHeight(struct Node* curr);
+struct Node* _rotateLeft(struct Node* curr);
+struct Node* _rotateRight(struct Node* curr);
+struct Node* _rebalance(struct Node* curr);
+
+void freezeBST(struct BST* tree, struct FrozenBST* frozen);
+void freeFrozenBST(struct FrozenBST* frozen);
+int containsFrozenBST(struct FrozenBST* frozen, TYPE val);
+void containsManyFrozenBST(struct FrozenBST* frozen, TYPE* vals, int n, int* out);
+int _lowerBoundFrozen(int k);
+void _prefetchFrozen(struct FrozenBST* frozen, int k);
+
+void buildBST(struct BST* tree, TYPE* vals, int n);
+void _sortVals(TYPE* vals, int n);
+int _compareVals(const void* a, const void* b);
+void _linkBalanced(struct Node* block, int* counts, int count, struct Node** root);
+struct Node* _addSlab(struct BST* tree, int capacity);
+struct Node* _newNode(struct BST* tree);
+void _freeNode(struct BST* tree, struct Node* node);
+
+int rankBST(struct BST* tree, TYPE val);
+int selectBST(struct BST* tree, int k, TYPE* out);
+int countRangeBST(struct BST* tree, TYPE lo, TYPE hi);
+int floorBST(struct BST* tree, TYPE val, TYPE* out);
+int ceilingBST(struct BST* tree, TYPE val, TYPE* out);
+int predecessorBST(struct BST* tree, TYPE val, TYPE* out);
+int successorBST(struct BST* tree, TYPE val, TYPE* out);
+int _rankNode(struct Node* curr, TYPE val, int inclusive);
+
+void unionBST(struct BST* tree, struct BST* other);
+void intersectBST(struct BST* tree, struct BST* other);
+void differenceBST(struct BST* tree, struct BST* other);
+struct Node* _unionNodes(struct BST* tree, struct Node* curr, struct Node* other);
+struct Node* _intersectNodes(struct BST* tree, struct Node* curr, struct Node* other);
+struct Node* _differenceNodes(struct BST* tree, struct Node* curr, struct Node* other);
+void _splitNodes(struct Node* curr, TYPE val, struct Node** left, struct Node** found, int* foundCount, struct Node** right);
+struct Node* _joinNodes(struct Node* left, struct Node* mid, int count, struct Node* right);
+struct Node* _joinPair(struct Node* left, struct Node* right);
+void _freeSubtree(struct BST* tree, struct Node* curr);
+void _adoptPool(struct BST* tree, struct BST* other);
+
+int saveBST(struct BST* tree, const char* fileName);
+int loadBST(struct BST* tree, const char* fileName);
+
+void shapeBST(struct BST* tree, struct BSTShape* shape);
+void dumpShapeBST(struct BST* tree, FILE* file);
+void resetStatsBST(struct BST* tree);
+
+void containsManyBST(struct BST* tree, TYPE* vals, int n, int* out);
+void _containsSorted(struct BST* tree, TYPE* vals, int n, int* out);
+void _containsInterleaved(struct BST* tree, TYPE* vals, int n, int* out);
 
 /* END Binary Search Tree */
 
@@ -7,9 +7,15 @@
 int main(int argc, char const *argv[])
 {
   struct BST bst;
+  struct BST other;
+  struct FrozenBST frozen;
   FILE* file;
   const char* fileName;
   int quantity;
+  int vals[25];
+  int probes[4] = { 747, 199, 500, 100 };
+  int found[4];
+  int n = 0;
   int val;
 
   if (argc == 2)
@@ -48,14 +54,10 @@ int main(int argc, char const *argv[])
 
   printf("- Adding values from %s...\n\n", fileName);
 
-  while ( !feof(file) && (quantity > 0) )
-  {
-    fscanf(file, "%d", &val);
-
-    addBST(&bst, val);
+  while ( (n < quantity) && (fscanf(file, "%d", &vals[n]) == 1) )
+    n++;
 
-    quantity--;
-  }
+  buildBST(&bst, vals, n);
 
   printf("- isEmpty: %d\n\n", isEmptyBST(&bst));
 
@@ -63,22 +65,75 @@ int main(int argc, char const *argv[])
   printf("- contains {199}?: %d\n\n", containsBST(&bst, 199));
   printf("- contains {500}?: %d\n\n", containsBST(&bst, 500));
 
+  containsManyBST(&bst, probes, 4, found);
+
+  printf("- containsMany {747, 199, 500, 100}?: %d %d %d %d\n\n", found[0], found[1], found[2], found[3]);
+
   printf("- Ready to print. Press ENTER.\n");
   getchar();
 
   printBST(&bst);
 
-  printf("\n- removing {747}\n\n");
+  printf("\n- insertUnique {199}: %d\n", insertUniqueBST(&bst, 199));
+  printf("- insertUnique {500}: %d\n", insertUniqueBST(&bst, 500));
 
-  removeBST(&bst, 747);
+  printf("\n- removing {747}: %d\n", removeBST(&bst, 747));
+  printf("- removing {747}: %d\n\n", removeBST(&bst, 747));
 
   printf("- contains {747}?: %d\n", containsBST(&bst, 747));
 
+  printf("\n- rank {500}: %d\n", rankBST(&bst, 500));
+
+  if ( selectBST(&bst, bst.size / 2, &val) )
+    printf("- median: %d\n", val);
+
+  printf("- count in [200, 600]: %d\n", countRangeBST(&bst, 200, 600));
+
+  if ( floorBST(&bst, 450, &val) )
+    printf("- floor {450}: %d\n", val);
+
+  if ( ceilingBST(&bst, 450, &val) )
+    printf("- ceiling {450}: %d\n", val);
+
+  initBST(&other);
+
+  insertUniqueBST(&other, 100);
+  insertUniqueBST(&other, 199);
+  insertUniqueBST(&other, 600);
+
+  printf("\n- union with {100, 199, 600}: ");
+
+  unionBST(&bst, &other);
+
+  printf("size %d, contains {100}?: %d\n", bst.size, containsBST(&bst, 100));
+
+  printf("\n- Saving to bst.bin: %d\n", saveBST(&bst, "bst.bin"));
+  printf("- Loading from bst.bin: %d, ", loadBST(&other, "bst.bin"));
+  printf("size %d, contains {100}?: %d\n", other.size, containsBST(&other, 100));
+
+  remove("bst.bin");
+
+  printf("\n- Shape: ");
+
+  dumpShapeBST(&bst, stdout);
+
+  printf("\n- Freezing BST...\n\n");
+
+  freezeBST(&bst, &frozen);
+
+  printf("- Frozen contains {199}?: %d\n", containsFrozenBST(&frozen, 199));
+  printf("- Frozen contains {747}?: %d\n", containsFrozenBST(&frozen, 747));
+
+  printf("\n- Freeing Frozen BST memory.\n");
+
+  freeFrozenBST(&frozen);
+
   printf("\n");
 
   printf("- Freeing BST memory.\n");
 
   freeBST(&bst);
+  freeBST(&other);
 
   /* --------------------------------------------
    *
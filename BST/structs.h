@@ -4,22 +4,89 @@
 # ifndef TYPE
 # define TYPE      int
 # define TYPE_SIZE sizeof(int)
+# define TYPE_INT          /* Values are plain ints: buildBST() may radix sort them */
 # define EQ(a,b) (a == b)
 # define LT(a,b) (a < b)
 # endif
 
+# define BST_MAX_HEIGHT 64 /* An AVL tree this tall needs more than 2^44 nodes */
+# define BST_MAX_SIZE   0x7FFFFFFF /* Most copies a BST holds: sizes are ints */
+
+# define BST_ADD_ALWAYS 0  /* Duplicates become separate nodes */
+# define BST_ADD_UNIQUE 1  /* Duplicates are not added */
+# define BST_ADD_COUNT  2  /* Duplicates increment the node's count (multiset mode) */
+
+# define FROZEN_BATCH   16 /* Searches interleaved by containsManyFrozenBST() */
+# define BST_PROBE_BATCH 16 /* Searches interleaved by containsManyBST(), on unsorted values */
+
+# define BST_MAGIC      0x42535431u /* "BST1", first word of a saveBST() file */
+
+# define BST_OP_CONTAINS 0 /* Operations counted when built with -DBST_STATS */
+# define BST_OP_ADD      1
+# define BST_OP_REMOVE   2
+
+# define BST_SLAB_NODES 1024 /* Nodes per slab added to the node pool by _newNode() */
+
+/* Slab of the node pool: the header is followed directly by 'capacity' nodes. */
+struct Slab
+{
+  struct Slab* next;
+  int capacity;
+};
+
+/* Comparison counters, per operation; only kept when built with -DBST_STATS.
+ * A comparison is one node visited: one EQ / LT test of the value against it. */
+struct BSTStats
+{
+  long calls[3];
+  long compares[3];
+};
+
+/* Shape report, filled by shapeBST(). Depths count nodes on the search path,
+ * the root being at depth 1, so they equal the comparisons to find a node. */
+struct BSTShape
+{
+  int nodes;
+  int height;                 /* Greatest depth: the worst-case search */
+  int minHeight;              /* Height of a perfectly balanced tree of as many nodes */
+  int maxImbalance;           /* Greatest height difference between two sibling subtrees */
+  double averageDepth;        /* Mean depth over all nodes: the average successful search */
+  int depths[BST_MAX_HEIGHT]; /* depths[d]: nodes at depth d + 1 */
+};
+
 struct BST
 {
   struct Node* root;
   int size;
+  int multiset;
+
+  struct Slab* slabs;     /* Node pool: every node lives in one of these */
+  struct Node* freeNodes; /* Released nodes, chained through 'left' */
+  int unused;             /* Nodes never handed out, at the end of the newest slab */
+
+# ifdef BST_STATS
+  struct BSTStats stats;
+# endif
+};
+
+/* Read-only snapshot of a BST: values in Eytzinger (BFS) order, 1-indexed,
+ * so the children of keys[k] are keys[2k] and keys[2k + 1]. keys[0] is unused. */
+struct FrozenBST
+{
+  TYPE* keys;
+  int size;
 };
 
+/* A node's count of copies is not stored: it is its size less its children's sizes
+ * (" _countNode() "), so the node stays at 32 bytes with 64-bit pointers, sizes included. */
 struct Node
 {
   struct Node* left;
   struct Node* right;
 
   TYPE val;
+  int height; /* AVL height, leaf is 1; sits in the padding after 'val' */
+  int size;   /* Copies held by this node's subtree, itself included */
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,566 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+/* --------------------------------------------
+ *
+ *                    CACHE
+ *
+ * Foundation used:   Hashtable (Hash-Link chains) + Deque (Double-Link)
+ *
+ * Sentinels:         Front & Back sentinels
+ *
+ * Front of the Deque is the most recently added/used entry,
+ * back of the Deque is the next eviction candidate.
+ *
+ * --------------------------------------------
+ */
+
+int stringHash(char* str)
+{
+
+  /* DJB HASH */
+
+  int hash = 5381;
+  int c;
+
+  while ( (c = *str++) )
+  {
+    hash = ((hash << 5) + hash) + c;
+  }
+
+  return hash;
+}
+
+void initCache(struct Cache* c, long capacity, int policy)
+{
+  /*  Description:
+   *    Function initializes a Cache structure using a pointer to its memory address.
+   *    The function allocates the bucket array and the front & back sentinels of the recency Deque.
+   *
+   *  Parameters:
+   *    [struct]  (Cache*)  c       : A pointer to the Cache.
+   *    [long]              capacity: The maximum number of bytes the entries may account for.
+   *    [int]               policy  : CACHE_LRU or CACHE_CLOCK.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'c' points to a proper memory location.
+   *    - There is memory available to allocate.
+   *
+   *  Post-conditions:
+   *    - The Cache is initialized: it is empty, its counters are 0, and linkages are correct.
+   */
+
+  int i;
+
+  assert(c);
+
+  c->tableSize = 16;
+  c->table = (struct DLink**) malloc(sizeof(struct DLink*) * c->tableSize);
+
+  c->head = (struct DLink*) malloc(sizeof(struct DLink));
+  c->tail = (struct DLink*) malloc(sizeof(struct DLink));
+
+  assert(c->table);
+  assert(c->head);
+  assert(c->tail);
+
+  for (i = 0; i < c->tableSize; i++)
+    c->table[i] = NULL;
+
+  c->head->next = c->tail;
+  c->tail->prev = c->head;
+
+  c->head->prev = NULL;
+  c->tail->next = NULL;
+
+  c->hand = NULL;
+
+  c->count = 0;
+  c->policy = policy;
+
+  c->bytes = 0;
+  c->capacity = capacity;
+
+  c->hits = 0;
+  c->misses = 0;
+  c->evictions = 0;
+}
+
+void freeCache(struct Cache* c)
+{
+  /*  Description:
+   *    Function frees all allocated memory associated with the Cache: entries, keys, sentinels and buckets.
+   *
+   *  Parameters:
+   *    [struct] (Cache*) c: A pointer to the Cache.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'c' points to a proper memory location.
+   *    - The Cache was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Cache's memory is freed.
+   */
+
+  struct DLink* curr, * temp;
+
+  assert(c);
+
+  curr = c->head;
+
+  while (curr)
+  {
+    temp = curr;
+
+    curr = curr->next;
+
+    if ( (temp != c->head) && (temp != c->tail) )
+      free(temp->key);
+
+    free(temp);
+  }
+
+  free(c->table);
+}
+
+ValueType* getCache(struct Cache* c, KeyType key)
+{
+  /*  Description:
+   *    Complexity O(1) on average.
+   *    Function looks the key up and, on a hit, records the access:
+   *
+   *    - LRU   -> the entry is moved to the front of the Deque.
+   *    - CLOCK -> the entry's reference bit is set; the Deque is left untouched.
+   *
+   *  Parameters:
+   *    [struct]  (Cache*)  c  : A pointer to the Cache.
+   *    [KeyType]           key: The key to search for.
+   *
+   *  Returns:
+   *    [ValueType*]  A pointer to the cached value, or NULL on a miss.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'c' points to a proper memory location.
+   *    - The Cache was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The hit or miss counter is incremented, and recency information is updated on a hit.
+   */
+
+  struct DLink* entry;
+
+  assert(c);
+
+  entry = _findEntry(c, key, stringHash(key));
+
+  if (entry == NULL)
+  {
+    c->misses++;
+
+    return NULL;
+  }
+
+  c->hits++;
+
+  if (c->policy == CACHE_LRU)
+  {
+    _unlinkEntry(c, entry);
+    _linkFront(c, entry);
+  }
+  else
+  {
+    entry->ref = 1;
+  }
+
+  return &entry->val;
+}
+
+int putCache(struct Cache* c, KeyType key, ValueType val, int bytes)
+{
+  /*  Description:
+   *    Complexity O(1) amortized.
+   *    Function inserts the key with the given value, or replaces the value of an existing key.
+   *    Entries are evicted, following the Cache's policy, until the new entry fits in the byte capacity.
+   *    The key string is copied; the caller keeps ownership of 'key'.
+   *
+   *  Parameters:
+   *    [struct]    (Cache*)  c    : A pointer to the Cache.
+   *    [KeyType]             key  : The key to insert.
+   *    [ValueType]           val  : The value to associate with the key.
+   *    [int]                 bytes: The size charged against the capacity for this entry.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the entry is cached, False if it is larger than the whole capacity.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'c' points to a proper memory location.
+   *    - The Cache was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The entry is at the front of the Deque, and the Cache's bytes do not exceed its capacity.
+   *    - If the entry does not fit, the key is no longer cached, so its old value is not served.
+   */
+
+  struct DLink* entry;
+  int hash;
+  int index;
+
+  assert(c);
+
+  if (bytes > c->capacity)
+  {
+    removeCache(c, key);
+
+    return 0;
+  }
+
+  hash = stringHash(key);
+  entry = _findEntry(c, key, hash);
+
+  if (entry)
+  {
+    /* Replace in place: the entry's old size no longer counts */
+    c->bytes -= entry->bytes;
+
+    _unlinkEntry(c, entry);
+    _unchainEntry(c, entry);
+    c->count--;
+  }
+  else
+  {
+    entry = (struct DLink*) malloc(sizeof(struct DLink));
+
+    assert(entry);
+
+    entry->key = (KeyType) malloc(strlen(key) + 1);
+
+    assert(entry->key);
+
+    strcpy(entry->key, key);
+  }
+
+  while (c->bytes + bytes > c->capacity)
+    evictCache(c);
+
+  entry->val = val;
+  entry->hash = hash;
+  entry->bytes = bytes;
+  entry->ref = 0;
+
+  if (c->count >= c->tableSize)
+    _resizeCache(c);
+
+  index = (int)(labs( hash ) % c->tableSize);
+
+  entry->chain = c->table[index];
+  c->table[index] = entry;
+
+  _linkFront(c, entry);
+
+  c->count++;
+  c->bytes += bytes;
+
+  return 1;
+}
+
+int removeCache(struct Cache* c, KeyType key)
+{
+  /*  Description:
+   *    Complexity O(1) on average.
+   *    Function removes the entry with the given key, if it is cached. This is not counted as an eviction.
+   *
+   *  Parameters:
+   *    [struct]  (Cache*)  c  : A pointer to the Cache.
+   *    [KeyType]           key: The key to remove.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if an entry was removed, False if the key was not cached.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'c' points to a proper memory location.
+   *    - The Cache was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The entry is unlinked from its bucket and from the Deque, and its memory is freed.
+   */
+
+  struct DLink* entry;
+
+  assert(c);
+
+  entry = _findEntry(c, key, stringHash(key));
+
+  if (entry == NULL)
+    return 0;
+
+  _dropEntry(c, entry);
+
+  return 1;
+}
+
+void evictCache(struct Cache* c)
+{
+  /*  Description:
+   *    Complexity O(1) for LRU, O(1) amortized for CLOCK.
+   *    Function evicts one entry, chosen by the Cache's policy:
+   *
+   *    - LRU   -> the entry at the back of the Deque (least recently used).
+   *    - CLOCK -> the hand sweeps from the back towards the front, wrapping around. Entries with their
+   *               reference bit set get a second chance (the bit is cleared), and the first entry found
+   *               without it is evicted. The hand rests on the next entry to inspect.
+   *
+   *  Parameters:
+   *    [struct] (Cache*) c: A pointer to the Cache.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'c' points to a proper memory location.
+   *    - The Cache was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - One entry is removed (if any exist), and the eviction counter is incremented.
+   */
+
+  struct DLink* victim;
+
+  assert(c);
+
+  if ( isEmptyCache(c) )
+    return;
+
+  if (c->policy == CACHE_LRU)
+  {
+    victim = c->tail->prev;
+  }
+  else
+  {
+    victim = c->hand ? c->hand : c->tail->prev;
+
+    while (victim->ref)
+    {
+      victim->ref = 0;
+
+      victim = (victim->prev == c->head) ? c->tail->prev : victim->prev;
+    }
+
+    /* Unlinking the victim moves the hand on to the next entry, where the next sweep resumes */
+    c->hand = victim;
+  }
+
+  _dropEntry(c, victim);
+
+  c->evictions++;
+}
+
+void printCache(struct Cache* c)
+{
+  /*  Description:
+   *    Function iterates through the Deque, from most to least recent, and prints each entry,
+   *    followed by the Cache's counters.
+   *
+   *  Parameters:
+   *    [struct] (Cache*) c: A pointer to the Cache.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'c' points to a proper memory location.
+   *    - The Cache was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Cache's entries and counters are printed to stdout.
+   */
+
+  struct DLink* curr;
+
+  assert(c);
+
+  printf("Front to Back:\n\n");
+
+  curr = c->head->next;
+
+  while (curr != c->tail)
+  {
+    printf("- %s: { %d } (%d bytes%s)\n", curr->key, curr->val, curr->bytes, curr->ref ? ", referenced" : "");
+
+    curr = curr->next;
+  }
+
+  printf("\n- Entries: %d, bytes: %ld / %ld\n", c->count, c->bytes, c->capacity);
+  printf("- Hits: %ld, misses: %ld, evictions: %ld\n", c->hits, c->misses, c->evictions);
+}
+
+int isEmptyCache(struct Cache* c)
+{
+  /*  Description:
+   *    Function checks the Cache's entry count and returns true or false.
+   *
+   *  Parameters:
+   *    [struct]  (Cache*)  c: A pointer to the Cache.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True or False, if the structure is empty or not.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'c' points to a proper memory location.
+   *    - The Cache was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - True (1) or False (0) is returned.
+   */
+
+  assert(c);
+
+  if (c->count == 0)
+  {
+    return 1;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+struct DLink* _findEntry(struct Cache* c, KeyType key, int hash)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Walks the key's bucket chain. The stored hash is compared first, and the key strings
+   *    only when the hashes match.
+   *
+   *  Post-conditions:
+   *    - The entry holding the key is returned, or NULL if the key is not cached.
+   */
+
+  struct DLink* curr;
+
+  curr = c->table[ labs( hash ) % c->tableSize ];
+
+  while (curr)
+  {
+
+    if ( EQ(curr->hash, hash) && (strcmp(curr->key, key) == 0) )
+      return curr;
+
+    curr = curr->chain;
+  }
+
+  return NULL;
+}
+
+void _linkFront(struct Cache* c, struct DLink* entry)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Links the entry after the front sentinel.
+   */
+
+  entry->next = c->head->next;
+  entry->prev = c->head;
+
+  entry->next->prev = entry;
+  c->head->next = entry;
+}
+
+void _unlinkEntry(struct Cache* c, struct DLink* entry)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Unlinks the entry from the Deque, re-linking its neighbours.
+   *    A CLOCK hand resting on the entry moves on to the next entry it would inspect.
+   */
+
+  if (c->hand == entry)
+    c->hand = (entry->prev == c->head) ? NULL : entry->prev;
+
+  entry->prev->next = entry->next;
+  entry->next->prev = entry->prev;
+}
+
+void _unchainEntry(struct Cache* c, struct DLink* entry)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Unlinks the entry from its bucket chain.
+   */
+
+  struct DLink** link;
+
+  link = &c->table[ labs( entry->hash ) % c->tableSize ];
+
+  while (*link != entry)
+    link = &(*link)->chain;
+
+  *link = entry->chain;
+}
+
+void _dropEntry(struct Cache* c, struct DLink* entry)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Unlinks the entry from its bucket and from the Deque, updates the book-keeping
+   *    and frees the entry's memory.
+   */
+
+  _unlinkEntry(c, entry);
+  _unchainEntry(c, entry);
+
+  c->count--;
+  c->bytes -= entry->bytes;
+
+  free(entry->key);
+  free(entry);
+}
+
+void _resizeCache(struct Cache* c)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Doubles the bucket array and re-chains every entry using its stored hash.
+   *    Entries are not re-allocated, and the Deque is left untouched.
+   */
+
+  int i;
+  int index;
+  int oldSize = c->tableSize;
+  struct DLink** oldTable = c->table;
+  struct DLink* curr;
+  struct DLink* next;
+
+  c->tableSize = 2 * oldSize;
+  c->table = (struct DLink**) malloc(sizeof(struct DLink*) * c->tableSize);
+
+  assert(c->table);
+
+  for (i = 0; i < c->tableSize; i++)
+    c->table[i] = NULL;
+
+  for (i = 0; i < oldSize; i++)
+  {
+    curr = oldTable[i];
+
+    while (curr)
+    {
+      next = curr->chain;
+
+      index = (int)(labs( curr->hash ) % c->tableSize);
+
+      curr->chain = c->table[index];
+      c->table[index] = curr;
+
+      curr = next;
+    }
+
+  }
+
+  free(oldTable);
+}
+
+/* --------------------------------------------
+ *
+ *                  END CACHE
+ *
+ * --------------------------------------------
+ */
@@ -0,0 +1,24 @@
+#include "structs.h"
+
+#ifndef __INTERFACES_H
+#define __INTERFACES_H
+
+/* CACHE */
+int stringHash(char* str);
+void initCache(struct Cache* c, long capacity, int policy);
+void freeCache(struct Cache* c);
+ValueType* getCache(struct Cache* c, KeyType key);
+int putCache(struct Cache* c, KeyType key, ValueType val, int bytes);
+int removeCache(struct Cache* c, KeyType key);
+void evictCache(struct Cache* c);
+void printCache(struct Cache* c);
+int isEmptyCache(struct Cache* c);
+struct DLink* _findEntry(struct Cache* c, KeyType key, int hash);
+void _linkFront(struct Cache* c, struct DLink* entry);
+void _unlinkEntry(struct Cache* c, struct DLink* entry);
+void _unchainEntry(struct Cache* c, struct DLink* entry);
+void _dropEntry(struct Cache* c, struct DLink* entry);
+void _resizeCache(struct Cache* c);
+/* END CACHE */
+
+#endif
\ No newline at end of file
@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+
+char* getWord(FILE *file); /* getWord function referenced from Professor Sinisa Todorovic */
+void fillCache(struct Cache* c, FILE* file);
+
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+int main(int argc, char const *argv[])
+{
+  struct Cache lru;
+  struct Cache clock;
+  struct Cache sweep;
+  FILE* file;
+  int missing;
+  int kept;
+
+  const char* fileName;
+
+  if (argc == 2)
+  {
+    fileName = argv[1];
+  }
+  else
+  {
+    fileName = "input.txt";
+  } 
+
+  file = fopen(fileName,"r");
+
+  printf("\n--------------------------------------------\n");
+
+  printf("\nHello! I'm here to generate simple visualizations of some basic data structures:\n");
+  printf("- Cache (LRU)\n- Cache (CLOCK)\n\n");
+
+  printf("Press ENTER to continue.\n\n");
+  getchar();
+
+  /* --------------------------------------------
+   *
+   *                 CACHE (LRU)
+   * 
+   * --------------------------------------------
+   */
+
+  printf("Here are some LRU Cache operations:\n\n");
+
+  initCache(&lru, 64, CACHE_LRU);
+
+  printf("- isEmpty: %d\n\n", isEmptyCache(&lru));
+
+  printf("- Counting words from %s, 64 bytes of capacity...\n\n", fileName);
+
+  fillCache(&lru, file);
+
+  printf("- isEmpty: %d\n\n", isEmptyCache(&lru));
+
+  printf("- Ready to print. Press ENTER.\n");
+  getchar();
+
+  printCache(&lru);
+
+  printf("\n");
+
+  printf("- Freeing Cache memory.\n");
+
+  freeCache(&lru);
+
+  /* --------------------------------------------
+   *
+   *               END CACHE (LRU)
+   * 
+   * --------------------------------------------
+   */
+
+  /*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+  /* --------------------------------------------
+   *
+   *                CACHE (CLOCK)
+   * 
+   * --------------------------------------------
+   */
+
+  rewind(file);
+
+  printf("\n");
+
+  printf("Here are some CLOCK Cache operations:\n\n");
+
+  initCache(&clock, 64, CACHE_CLOCK);
+
+  printf("- Counting words from %s, 64 bytes of capacity...\n\n", fileName);
+
+  fillCache(&clock, file);
+
+  printf("- Ready to print. Press ENTER.\n");
+  getchar();
+
+  printCache(&clock);
+
+  printf("\n");
+
+  printf("- Freeing Cache memory.\n\n");
+
+  freeCache(&clock);
+
+  /* The hand must carry over between evictions: with "a" & "b" referenced, the first sweep clears
+   * their bits and evicts "c"; the second resumes at "d" rather than restarting from "a". */
+  printf("- Evicting twice from { d, c, b, a }, with \"a\" & \"b\" referenced...\n\n");
+
+  initCache(&sweep, 4, CACHE_CLOCK);
+
+  putCache(&sweep, "a", 1, 1);
+  putCache(&sweep, "b", 2, 1);
+  putCache(&sweep, "c", 3, 1);
+  putCache(&sweep, "d", 4, 1);
+
+  getCache(&sweep, "a");
+  getCache(&sweep, "b");
+
+  evictCache(&sweep);
+
+  printf("- First eviction took  \"c\": %d\n", (removeCache(&sweep, "c") == 0));
+
+  evictCache(&sweep);
+
+  printf("- Second eviction took \"d\": %d\n", (removeCache(&sweep, "d") == 0));
+
+  missing = removeCache(&sweep, "d");
+  kept = removeCache(&sweep, "a") + removeCache(&sweep, "b");
+
+  printf("- \"d\" gone, \"a\" & \"b\" kept: %d\n\n", (missing == 0) && (kept == 2));
+
+  assert( (missing == 0) && (kept == 2) );
+
+  printf("- Replacing \"a\" with an entry larger than the Cache...\n\n");
+
+  putCache(&sweep, "a", 1, 1);
+
+  printf("- Oversized put cached:  %d\n", putCache(&sweep, "a", 2, 5));
+  printf("- Old \"a\" still served: %d\n\n", (getCache(&sweep, "a") != NULL));
+
+  freeCache(&sweep);
+
+  /* --------------------------------------------
+   *
+   *              END CACHE (CLOCK)
+   * 
+   * --------------------------------------------
+   */
+
+  printf("\n--------------------------------------------\n");
+
+  fclose(file);
+  
+  return 0;
+}
+
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+void fillCache(struct Cache* c, FILE* file)
+{
+  char* word;
+  ValueType* count;
+
+  do
+  {
+    word = getWord(file);
+
+    if (word)
+    {
+      count = getCache(c, word);
+
+      if (count)
+      {
+        (*count)++;
+      }
+      else
+      {
+        putCache(c, word, 1, (int) strlen(word));
+      }
+
+      free(word);
+    }
+
+  } while (word);
+
+}
+
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+char* getWord(FILE *file)
+{
+  
+  int length = 0;
+  int maxLength = 16;
+  char character;
+    
+  char* word = (char*)malloc(sizeof(char) * maxLength);
+  assert(word != NULL);
+    
+  while( (character = fgetc(file)) != EOF)
+  {
+    if((length+1) > maxLength)
+    {
+      maxLength *= 2;
+      word = (char*)realloc(word, maxLength);
+    }
+    if((character >= '0' && character <= '9') || /*is a number*/
+       (character >= 'A' && character <= 'Z') || /*or an uppercase letter*/
+       (character >= 'a' && character <= 'z') || /*or a lowercase letter*/
+       character == 39) /*or is an apostrophy*/
+    {
+      word[length] = character;
+      length++;
+    }
+    else if(length > 0)
+      break;
+  }
+    
+  if(length == 0)
+  {
+    free(word);
+    return NULL;
+  }
+  word[length] = '\0';
+  return word;
+}
@@ -0,0 +1,53 @@
+#ifndef __STRUCTS_H
+#define __STRUCTS_H
+
+# ifndef TYPE
+# define TYPE      int
+# define TYPE_SIZE sizeof(int)
+# define EQ(a,b) (a == b)
+# define LT(a,b) (a < b)
+# endif
+
+# define KeyType   char*
+# define ValueType TYPE
+
+# define CACHE_LRU   0
+# define CACHE_CLOCK 1
+
+/* Double-Link, intrusive: the same node sits in the recency Deque (next & prev)
+ * and in its hash bucket's chain (chain), so an entry is a single allocation. */
+struct DLink
+{
+  struct DLink* next;
+  struct DLink* prev;
+  struct DLink* chain;
+
+  KeyType   key;
+  ValueType val;
+
+  int hash;
+  int bytes;
+  int ref;
+};
+
+struct Cache
+{
+  struct DLink** table;
+
+  struct DLink* head;
+  struct DLink* tail;
+  struct DLink* hand;
+
+  int tableSize;
+  int count;
+  int policy;
+
+  long bytes;
+  long capacity;
+
+  long hits;
+  long misses;
+  long evictions;
+};
+
+#endif
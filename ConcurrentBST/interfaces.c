@@ -0,0 +1,1026 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+/* --------------------------------------------
+ *
+ *          CONCURRENT BINARY SEARCH TREE
+ *
+ * Foundation used:   Node (immutable, AVL-balanced)
+ *
+ * Published nodes are never modified. A writer copies the path it changes
+ * (and any node a rotation touches), then publishes the new root with one
+ * atomic store: readers see either the old version or the new one, whole,
+ * and never wait. Writers are serialized by a mutex.
+ *
+ * Versions share every node they did not change, so nodes are reference
+ * counted: a node's count is its parents, plus the tree or the snapshots
+ * holding it as their root. Snapshots are O(1), and stay readable until
+ * released.
+ *
+ * A root dropped by the tree may still be searched by readers, so it is
+ * reclaimed by epochs: a reader announces the epoch it started in, and a
+ * root retired in an epoch is only freed once every active reader has
+ * announced a later one, two epochs on. Freeing it releases its children,
+ * and every node no other version shares goes with it.
+ *
+ * Requires GCC atomic builtins and POSIX threads.
+ *
+ * --------------------------------------------
+ */
+
+void initCBST(struct CBST* tree)
+{
+  /*  Description:
+   *    Function initializes a concurrent BST structure using a pointer to its memory address.
+   *    The function does not allocate node memory upon initialization.
+   *
+   *  Parameters:
+   *    [struct] (CBST*) tree: A pointer to the concurrent BST.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - No other thread uses the structure yet.
+   *
+   *  Post-conditions:
+   *    - The concurrent BST is initialized: the size is 0, the root points to NULL,
+   *      and no reader slot is taken.
+   */
+
+  int i;
+
+  assert(tree);
+
+  tree->root = NULL;
+  tree->size = 0;
+
+  pthread_mutex_init(&tree->writer, NULL);
+
+  tree->stamp = 0;
+  tree->epoch = 0;
+
+  for (i = 0; i < 3; i++)
+  {
+    tree->limbo[i].nodes = NULL;
+    tree->limbo[i].count = 0;
+    tree->limbo[i].capacity = 0;
+  }
+
+  tree->readers = 0;
+
+  for (i = 0; i < CBST_READERS; i++)
+  {
+    tree->reader[i].state = 0;
+    tree->reader[i].taken = 0;
+  }
+
+}
+
+void freeCBST(struct CBST* tree)
+{
+  /*  Description:
+   *    Function releases the published version, freeing every node no snapshot holds,
+   *    then frees every retired root still waiting for its epoch, the same way.
+   *
+   *  Parameters:
+   *    [struct] (CBST*) tree: A pointer to the concurrent BST.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - No other thread uses the structure any more, and every snapshot was released.
+   *
+   *  Post-conditions:
+   *    - The concurrent BST's memory is freed.
+   */
+
+  int i;
+  int j;
+
+  assert(tree);
+
+  if ( tree->root && __atomic_sub_fetch(&tree->root->refs, 1, __ATOMIC_SEQ_CST) == 0 )
+    _freeCascade(tree->root);
+
+  for (i = 0; i < 3; i++)
+  {
+
+    for (j = 0; j < tree->limbo[i].count; j++)
+      _freeCascade(tree->limbo[i].nodes[j]);
+
+    free(tree->limbo[i].nodes);
+  }
+
+  pthread_mutex_destroy(&tree->writer);
+
+  tree->root = NULL;
+  tree->size = 0;
+}
+
+int joinCBST(struct CBST* tree)
+{
+  /*  Description:
+   *    Function hands out a free reader slot, the lowest one, so writers scan as few as possible.
+   *    Every thread that searches the tree takes its own slot once, passes it to
+   *    " containsCBST() ", " printCBST() " and " snapshotCBST() ", and gives it back with
+   *    " leaveCBST() ".
+   *
+   *  Parameters:
+   *    [struct] (CBST*) tree: A pointer to the concurrent BST.
+   *
+   *  Returns:
+   *    [int]     The reader slot.
+   *
+   *  Pre-conditions:
+   *    - Fewer than CBST_READERS slots are taken.
+   *
+   *  Post-conditions:
+   *    - The slot is taken until it is given back, and writers scan it for announcements.
+   */
+
+  int slot;
+  int readers;
+  int expected;
+
+  assert(tree);
+
+  for (slot = 0; slot < CBST_READERS; slot++)
+  {
+    expected = 0;
+
+    if ( __atomic_compare_exchange_n(&tree->reader[slot].taken, &expected, 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) )
+      break;
+
+  }
+
+  assert(slot < CBST_READERS);
+
+  /* Raised before the slot is used, so a writer never misses its announcements */
+  readers = __atomic_load_n(&tree->readers, __ATOMIC_SEQ_CST);
+
+  while ( readers <= slot
+          && !__atomic_compare_exchange_n(&tree->readers, &readers, slot + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) )
+    ;
+
+  return slot;
+}
+
+void leaveCBST(struct CBST* tree, int slot)
+{
+  /*  Description:
+   *    Function gives back a reader slot from " joinCBST() ", for another thread to take.
+   *    The slot's announcement is cleared first, so writers no longer wait on it.
+   *
+   *  Parameters:
+   *    [struct] (CBST*) tree: A pointer to the concurrent BST.
+   *    [int]            slot: The calling thread's reader slot, from " joinCBST() ".
+   *
+   *  Pre-conditions:
+   *    - The calling thread took the slot, and is not searching with it.
+   *
+   *  Post-conditions:
+   *    - The slot is free, and the calling thread may no longer use it.
+   */
+
+  assert(tree);
+  assert(slot >= 0 && slot < CBST_READERS);
+
+  __atomic_store_n(&tree->reader[slot].state, 0, __ATOMIC_SEQ_CST);
+  __atomic_store_n(&tree->reader[slot].taken, 0, __ATOMIC_SEQ_CST);
+}
+
+int containsCBST(struct CBST* tree, int slot, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)), wait-free.
+   *    Function announces the current epoch in the reader's slot, loads the published root,
+   *    and searches that version with no lock: its nodes are never modified, and are not
+   *    freed until the announcement is withdrawn.
+   *
+   *  Parameters:
+   *    [struct] (CBST*) tree: A pointer to the concurrent BST.
+   *    [int]            slot: The calling thread's reader slot, from " joinCBST() ".
+   *    [TYPE]           val : The value to search for.
+   *
+   *  Pre-conditions:
+   *    - No other thread uses the same reader slot.
+   *
+   *  Post-conditions:
+   *    - The function returns True (1) if the value is contained, or False (0) if not,
+   *      as of some instant during the call.
+   */
+
+  struct CReader* reader;
+  struct CNode* curr;
+  int found = 0;
+
+  assert(tree);
+  assert(slot >= 0 && slot < CBST_READERS);
+
+  reader = &tree->reader[slot];
+
+  __atomic_store_n(&reader->state, (__atomic_load_n(&tree->epoch, __ATOMIC_SEQ_CST) << 1) | 1, __ATOMIC_SEQ_CST);
+
+  curr = __atomic_load_n(&tree->root, __ATOMIC_SEQ_CST);
+
+  while (curr)
+  {
+
+    if ( EQ(val, curr->val) )
+    {
+      found = 1;
+
+      break;
+    }
+    else if ( LT(val, curr->val) )
+    {
+      curr = curr->left;
+    }
+    else
+    {
+      curr = curr->right;
+    }
+
+  }
+
+  __atomic_store_n(&reader->state, 0, __ATOMIC_RELEASE);
+
+  return found;
+}
+
+int addCBST(struct CBST* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function takes the writer lock and descends the published version, recording the path.
+   *    A new node is created for the value, and the path is retraced bottom-up: each node on it
+   *    is copied (" _ownNode() ") to point at the new child, and re-balanced. The new root is
+   *    then published, and the replaced version is released.
+   *
+   *  Parameters:
+   *    [struct] (CBST*) tree: A pointer to the concurrent BST.
+   *    [TYPE]           val : The value to insert.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was added, False if it was already contained.
+   *
+   *  Pre-conditions:
+   *    - The concurrent BST was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The value is contained exactly once.
+   */
+
+  struct CNode* path[CBST_MAX_HEIGHT];
+  int right[CBST_MAX_HEIGHT];
+  struct CNode* curr;
+  struct CNode* child;
+  int depth = 0;
+
+  assert(tree);
+
+  pthread_mutex_lock(&tree->writer);
+
+  tree->stamp++;
+
+  curr = tree->root;
+
+  while (curr)
+  {
+
+    if ( EQ(val, curr->val) )
+    {
+      pthread_mutex_unlock(&tree->writer);
+
+      return 0;
+    }
+
+    path[depth] = curr;
+    right[depth] = !LT(val, curr->val);
+
+    curr = right[depth] ? curr->right : curr->left;
+
+    depth++;
+  }
+
+  child = _newNode(tree, val);
+
+  while (depth > 0)
+  {
+    depth--;
+
+    curr = _ownNode(tree, path[depth]);
+
+    if (right[depth])
+    {
+      curr->right = child;
+    }
+    else
+    {
+      curr->left = child;
+    }
+
+    child = _rebalance(tree, curr);
+  }
+
+  _publishRoot(tree, child);
+
+  tree->size++;
+
+  _advanceEpoch(tree);
+
+  pthread_mutex_unlock(&tree->writer);
+
+  return 1;
+}
+
+int removeCBST(struct CBST* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function takes the writer lock and descends the published version to the value's node,
+   *    recording the path:
+   *
+   *    - No right child -> its left child takes its place.
+   *    - Right child    -> the path is extended down to the leftmost node of the right subtree,
+   *                        whose right child takes that node's place; the removal node's copy
+   *                        takes the leftmost node's value.
+   *
+   *    The path is then retraced bottom-up, copied and re-balanced as in " addCBST() ",
+   *    and the new root is published.
+   *
+   *  Parameters:
+   *    [struct] (CBST*) tree: A pointer to the concurrent BST.
+   *    [TYPE]           val : The value to remove.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was removed, False if it was not contained.
+   *
+   *  Pre-conditions:
+   *    - The concurrent BST was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The value is not contained.
+   */
+
+  struct CNode* path[CBST_MAX_HEIGHT];
+  int right[CBST_MAX_HEIGHT];
+  struct CNode* curr;
+  struct CNode* child;
+  TYPE successor = val;
+  int target = -1;
+  int depth = 0;
+
+  assert(tree);
+
+  pthread_mutex_lock(&tree->writer);
+
+  tree->stamp++;
+
+  curr = tree->root;
+
+  while ( curr && !EQ(val, curr->val) )
+  {
+    path[depth] = curr;
+    right[depth] = !LT(val, curr->val);
+
+    curr = right[depth] ? curr->right : curr->left;
+
+    depth++;
+  }
+
+  if (curr == NULL)
+  {
+    pthread_mutex_unlock(&tree->writer);
+
+    return 0;
+  }
+
+  if (curr->right == NULL)
+  {
+    child = curr->left;
+  }
+  else
+  {
+    target = depth;
+
+    path[depth] = curr;
+    right[depth] = 1;
+    depth++;
+
+    curr = curr->right;
+
+    while (curr->left)
+    {
+      path[depth] = curr;
+      right[depth] = 0;
+      depth++;
+
+      curr = curr->left;
+    }
+
+    successor = curr->val;
+    child = curr->right;
+  }
+
+  while (depth > 0)
+  {
+    depth--;
+
+    curr = _ownNode(tree, path[depth]);
+
+    if (depth == target)
+      curr->val = successor;
+
+    if (right[depth])
+    {
+      curr->right = child;
+    }
+    else
+    {
+      curr->left = child;
+    }
+
+    child = _rebalance(tree, curr);
+  }
+
+  _publishRoot(tree, child);
+
+  tree->size--;
+
+  _advanceEpoch(tree);
+
+  pthread_mutex_unlock(&tree->writer);
+
+  return 1;
+}
+
+void printCBST(struct CBST* tree, int slot)
+{
+  /*  Description:
+   *    Function prints the published version in-order, as a reader: the version printed is
+   *    the one published when the call began. Ancestors still to be printed are kept
+   *    on an explicit stack, whose size is bounded by the AVL height.
+   *
+   *  Parameters:
+   *    [struct] (CBST*) tree: A pointer to the concurrent BST.
+   *    [int]            slot: The calling thread's reader slot, from " joinCBST() ".
+   *
+   *  Post-conditions:
+   *    - The function prints the values in-order to stdout.
+   */
+
+  struct CNode* stack[CBST_MAX_HEIGHT];
+  struct CReader* reader;
+  struct CNode* curr;
+  int top = 0;
+
+  assert(tree);
+  assert(slot >= 0 && slot < CBST_READERS);
+
+  reader = &tree->reader[slot];
+
+  __atomic_store_n(&reader->state, (__atomic_load_n(&tree->epoch, __ATOMIC_SEQ_CST) << 1) | 1, __ATOMIC_SEQ_CST);
+
+  curr = __atomic_load_n(&tree->root, __ATOMIC_SEQ_CST);
+
+  while (curr || top > 0)
+  {
+
+    while (curr)
+    {
+      stack[top++] = curr;
+      curr = curr->left;
+    }
+
+    curr = stack[--top];
+
+    printf("Node with value: { %d }\n", curr->val);
+
+    curr = curr->right;
+  }
+
+  __atomic_store_n(&reader->state, 0, __ATOMIC_RELEASE);
+}
+
+int isEmptyCBST(struct CBST* tree)
+{
+  /*  Description:
+   *    Function checks whether the published version has a root.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True or False, if the structure is empty or not.
+   */
+
+  assert(tree);
+
+  if ( __atomic_load_n(&tree->root, __ATOMIC_SEQ_CST) == NULL )
+  {
+    return 1;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+void snapshotCBST(struct CBST* tree, int slot, struct CVersion* version)
+{
+  /*  Description:
+   *    Complexity O(1), lock-free.
+   *    Function takes a reference to the published root, as a reader: the root cannot be freed
+   *    while the epoch is announced, but it may already have been dropped by a writer, with no
+   *    references left. The reference count is then only raised from a non-zero value, and the
+   *    root is reloaded otherwise.
+   *
+   *  Parameters:
+   *    [struct] (CBST*)     tree   : A pointer to the concurrent BST.
+   *    [int]                slot   : The calling thread's reader slot, from " joinCBST() ".
+   *    [struct] (CVersion*) version: Receives the snapshot.
+   *
+   *  Post-conditions:
+   *    - The snapshot holds the version published at some instant during the call,
+   *      unaffected by later writes, until " releaseVersionCBST() ".
+   */
+
+  struct CReader* reader;
+  struct CNode* root;
+  int refs;
+
+  assert(tree);
+  assert(version);
+  assert(slot >= 0 && slot < CBST_READERS);
+
+  reader = &tree->reader[slot];
+
+  __atomic_store_n(&reader->state, (__atomic_load_n(&tree->epoch, __ATOMIC_SEQ_CST) << 1) | 1, __ATOMIC_SEQ_CST);
+
+  for (;;)
+  {
+    root = __atomic_load_n(&tree->root, __ATOMIC_SEQ_CST);
+
+    if (root == NULL)
+      break;
+
+    refs = __atomic_load_n(&root->refs, __ATOMIC_SEQ_CST);
+
+    if ( refs > 0 && __atomic_compare_exchange_n(&root->refs, &refs, refs + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) )
+      break;
+
+  }
+
+  __atomic_store_n(&reader->state, 0, __ATOMIC_RELEASE);
+
+  version->root = root;
+}
+
+int containsVersionCBST(struct CVersion* version, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)), wait-free.
+   *    Function searches a snapshot. It holds its nodes, so no epoch needs announcing.
+   *
+   *  Parameters:
+   *    [struct] (CVersion*) version: A pointer to the snapshot.
+   *    [TYPE]               val    : The value to search for.
+   *
+   *  Post-conditions:
+   *    - The function returns True (1) if the value is contained in the snapshot, or False (0) if not.
+   */
+
+  struct CNode* curr;
+
+  assert(version);
+
+  curr = version->root;
+
+  while (curr)
+  {
+
+    if ( EQ(val, curr->val) )
+    {
+      return 1;
+    }
+    else if ( LT(val, curr->val) )
+    {
+      curr = curr->left;
+    }
+    else
+    {
+      curr = curr->right;
+    }
+
+  }
+
+  return 0;
+}
+
+void printVersionCBST(struct CVersion* version)
+{
+  /*  Description:
+   *    Function prints a snapshot in-order, with an explicit stack bounded by the AVL height.
+   *
+   *  Parameters:
+   *    [struct] (CVersion*) version: A pointer to the snapshot.
+   *
+   *  Post-conditions:
+   *    - The function prints the snapshot's values in-order to stdout.
+   */
+
+  struct CNode* stack[CBST_MAX_HEIGHT];
+  struct CNode* curr;
+  int top = 0;
+
+  assert(version);
+
+  curr = version->root;
+
+  while (curr || top > 0)
+  {
+
+    while (curr)
+    {
+      stack[top++] = curr;
+      curr = curr->left;
+    }
+
+    curr = stack[--top];
+
+    printf("Node with value: { %d }\n", curr->val);
+
+    curr = curr->right;
+  }
+
+}
+
+void releaseVersionCBST(struct CBST* tree, struct CVersion* version)
+{
+  /*  Description:
+   *    Function drops a snapshot's reference to its root. If that was the last one, the root
+   *    is retired like one the tree dropped, since readers may still be searching it.
+   *
+   *  Parameters:
+   *    [struct] (CBST*)     tree   : A pointer to the concurrent BST the snapshot was taken of.
+   *    [struct] (CVersion*) version: A pointer to the snapshot.
+   *
+   *  Post-conditions:
+   *    - The snapshot is empty; nodes only it held are freed after the epoch passes.
+   */
+
+  assert(tree);
+  assert(version);
+
+  pthread_mutex_lock(&tree->writer);
+
+  if ( version->root && __atomic_sub_fetch(&version->root->refs, 1, __ATOMIC_SEQ_CST) == 0 )
+  {
+    _retireNode(tree, version->root);
+
+    _advanceEpoch(tree);
+  }
+
+  pthread_mutex_unlock(&tree->writer);
+
+  version->root = NULL;
+}
+
+void _publishRoot(struct CBST* tree, struct CNode* root)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Makes a new version visible to readers. Its nodes' references are counted first
+   *    (" _shareChildren() "), and the store orders every write to them before it, so a reader
+   *    that loads the root sees them complete. The tree's reference moves to the new root,
+   *    and the old root is retired if nothing else holds it.
+   */
+
+  struct CNode* old = tree->root;
+
+  _shareChildren(tree, root);
+
+  if ( root && root->stamp != tree->stamp )
+    __atomic_add_fetch(&root->refs, 1, __ATOMIC_SEQ_CST);
+
+  __atomic_store_n(&tree->root, root, __ATOMIC_SEQ_CST);
+
+  if ( old && __atomic_sub_fetch(&old->refs, 1, __ATOMIC_SEQ_CST) == 0 )
+    _retireNode(tree, old);
+
+}
+
+void _shareChildren(struct CBST* tree, struct CNode* root)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Walks the nodes the current write created, which hang together from the new root, and
+   *    adds a reference to every older node they point at: those are now shared with the
+   *    version being replaced. The new nodes themselves have their single parent's reference.
+   */
+
+  struct CNode* stack[2 * CBST_MAX_HEIGHT];
+  struct CNode* child[2];
+  struct CNode* node;
+  int top = 0;
+  int i;
+
+  if ( root && root->stamp == tree->stamp )
+    stack[top++] = root;
+
+  while (top > 0)
+  {
+    node = stack[--top];
+
+    child[0] = node->left;
+    child[1] = node->right;
+
+    for (i = 0; i < 2; i++)
+    {
+
+      if (child[i] == NULL)
+        continue;
+
+      if (child[i]->stamp == tree->stamp)
+      {
+        stack[top++] = child[i];
+      }
+      else
+      {
+        __atomic_add_fetch(&child[i]->refs, 1, __ATOMIC_SEQ_CST);
+      }
+
+    }
+
+  }
+
+}
+
+void _freeCascade(struct CNode* node)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Frees a node with no references left, and drops its references to its children;
+   *    each child left with none is freed in turn, with an explicit stack. Nodes shared with
+   *    another version keep their references, and stop the cascade.
+   */
+
+  struct CNode* stack[2 * CBST_MAX_HEIGHT];
+  int top = 0;
+
+  stack[top++] = node;
+
+  while (top > 0)
+  {
+    node = stack[--top];
+
+    if ( node->left && __atomic_sub_fetch(&node->left->refs, 1, __ATOMIC_SEQ_CST) == 0 )
+      stack[top++] = node->left;
+
+    if ( node->right && __atomic_sub_fetch(&node->right->refs, 1, __ATOMIC_SEQ_CST) == 0 )
+      stack[top++] = node->right;
+
+    free(node);
+  }
+
+}
+
+struct CNode* _newNode(struct CBST* tree, TYPE val)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Allocates a leaf with the given value, stamped as private to the current write.
+   */
+
+  struct CNode* node = (struct CNode*) malloc(sizeof(struct CNode));
+
+  assert(node);
+
+  node->left = NULL;
+  node->right = NULL;
+  node->val = val;
+  node->height = 1;
+  node->stamp = tree->stamp;
+  node->refs = 1;
+
+  return node;
+}
+
+struct CNode* _ownNode(struct CBST* tree, struct CNode* node)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns a node the current write may modify: the node itself if the write created it,
+   *    else a private copy of it. The original stays in the version being replaced.
+   */
+
+  struct CNode* copy;
+
+  if (node->stamp == tree->stamp)
+    return node;
+
+  copy = (struct CNode*) malloc(sizeof(struct CNode));
+
+  assert(copy);
+
+  /* Field by field: a snapshot may be updating the original's 'refs' */
+  copy->left = node->left;
+  copy->right = node->right;
+  copy->val = node->val;
+  copy->height = node->height;
+  copy->stamp = tree->stamp;
+  copy->refs = 1;
+
+  return copy;
+}
+
+void _retireNode(struct CBST* tree, struct CNode* node)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Queues a root with no references left, in the current epoch's limbo list; readers may
+   *    still be searching it, so it is freed by " _advanceEpoch() ".
+   */
+
+  struct CLimbo* limbo = &tree->limbo[tree->epoch % 3];
+
+  if (limbo->count == limbo->capacity)
+  {
+    limbo->capacity = limbo->capacity ? 2 * limbo->capacity : 64;
+    limbo->nodes = (struct CNode**) realloc(limbo->nodes, sizeof(struct CNode*) * limbo->capacity);
+
+    assert(limbo->nodes);
+  }
+
+  limbo->nodes[limbo->count++] = node;
+}
+
+void _advanceEpoch(struct CBST* tree)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Moves to the next epoch if every active reader has announced the current one. Any reader
+   *    still able to reach a root retired two epochs back would have announced an older epoch,
+   *    so those roots are freed, along with the nodes only they reach, and their limbo list is
+   *    reused for the new epoch.
+   *
+   *  Pre-conditions:
+   *    - The writer lock is held, and the new version is published.
+   */
+
+  struct CLimbo* limbo;
+  unsigned long state;
+  int readers;
+  int i;
+
+  readers = __atomic_load_n(&tree->readers, __ATOMIC_SEQ_CST);
+
+  if (readers > CBST_READERS)
+    readers = CBST_READERS;
+
+  for (i = 0; i < readers; i++)
+  {
+    state = __atomic_load_n(&tree->reader[i].state, __ATOMIC_SEQ_CST);
+
+    if ( (state & 1) && (state >> 1) != tree->epoch )
+      return;
+
+  }
+
+  __atomic_store_n(&tree->epoch, tree->epoch + 1, __ATOMIC_SEQ_CST);
+
+  limbo = &tree->limbo[tree->epoch % 3];
+
+  for (i = 0; i < limbo->count; i++)
+    _freeCascade(limbo->nodes[i]);
+
+  limbo->count = 0;
+}
+
+int _heightNode(struct CNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns the stored AVL height of the node, where a NULL pointer has height 0.
+   */
+
+  if (curr)
+  {
+    return curr->height;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+void _updateHeight(struct CNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Recomputes the node's height from its children's stored heights.
+   *
+   *  Pre-conditions:
+   *    - The node is private to the current write.
+   */
+
+  int left = _heightNode(curr->left);
+  int right = _heightNode(curr->right);
+
+  curr->height = 1 + ((left > right) ? left : right);
+}
+
+struct CNode* _rotateLeft(struct CNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Rotates the subtree left: the right child becomes the subtree root,
+   *    and the current node becomes its left child.
+   *
+   *  Pre-conditions:
+   *    - The node and its right child are private to the current write.
+   */
+
+  struct CNode* right = curr->right;
+
+  curr->right = right->left;
+  right->left = curr;
+
+  _updateHeight(curr);
+  _updateHeight(right);
+
+  return right;
+}
+
+struct CNode* _rotateRight(struct CNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Rotates the subtree right: the left child becomes the subtree root,
+   *    and the current node becomes its right child. Mirror of " _rotateLeft() ".
+   *
+   *  Pre-conditions:
+   *    - The node and its left child are private to the current write.
+   */
+
+  struct CNode* left = curr->left;
+
+  curr->left = left->right;
+  left->right = curr;
+
+  _updateHeight(curr);
+  _updateHeight(left);
+
+  return left;
+}
+
+struct CNode* _rebalance(struct CBST* tree, struct CNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Restores the AVL property at the current node, as the BST's " _rebalance() " does.
+   *    A rotation also modifies the child it lifts (and, for a double rotation, the grandchild),
+   *    so those are made private first.
+   *
+   *  Parameters:
+   *    [struct] (CBST*)  tree: A pointer to the concurrent BST.
+   *    [struct] (CNode*) curr: A pointer to the subtree root, private to the current write.
+   *
+   *  Post-conditions:
+   *    - The subtree is AVL-balanced, and its new root is returned.
+   */
+
+  int balance;
+
+  _updateHeight(curr);
+
+  balance = _heightNode(curr->left) - _heightNode(curr->right);
+
+  if (balance > 1)
+  {
+    curr->left = _ownNode(tree, curr->left);
+
+    if ( _heightNode(curr->left->left) < _heightNode(curr->left->right) )
+    {
+      curr->left->right = _ownNode(tree, curr->left->right);
+      curr->left = _rotateLeft(curr->left);
+    }
+
+    return _rotateRight(curr);
+  }
+  else if (balance < -1)
+  {
+    curr->right = _ownNode(tree, curr->right);
+
+    if ( _heightNode(curr->right->right) < _heightNode(curr->right->left) )
+    {
+      curr->right->left = _ownNode(tree, curr->right->left);
+      curr->right = _rotateRight(curr->right);
+    }
+
+    return _rotateLeft(curr);
+  }
+
+  return curr;
+}
@@ -0,0 +1,34 @@
+#include "structs.h"
+
+#ifndef __INTERFACES_H
+#define __INTERFACES_H
+
+/* Concurrent Binary Search Tree */
+void initCBST(struct CBST* tree);
+void freeCBST(struct CBST* tree);
+int joinCBST(struct CBST* tree);
+void leaveCBST(struct CBST* tree, int slot);
+int containsCBST(struct CBST* tree, int slot, TYPE val);
+int addCBST(struct CBST* tree, TYPE val);
+int removeCBST(struct CBST* tree, TYPE val);
+void printCBST(struct CBST* tree, int slot);
+int isEmptyCBST(struct CBST* tree);
+void snapshotCBST(struct CBST* tree, int slot, struct CVersion* version);
+int containsVersionCBST(struct CVersion* version, TYPE val);
+void printVersionCBST(struct CVersion* version);
+void releaseVersionCBST(struct CBST* tree, struct CVersion* version);
+void _publishRoot(struct CBST* tree, struct CNode* root);
+void _shareChildren(struct CBST* tree, struct CNode* root);
+void _freeCascade(struct CNode* node);
+struct CNode* _newNode(struct CBST* tree, TYPE val);
+struct CNode* _ownNode(struct CBST* tree, struct CNode* node);
+void _retireNode(struct CBST* tree, struct CNode* node);
+void _advanceEpoch(struct CBST* tree);
+int _heightNode(struct CNode* curr);
+void _updateHeight(struct CNode* curr);
+struct CNode* _rotateLeft(struct CNode* curr);
+struct CNode* _rotateRight(struct CNode* curr);
+struct CNode* _rebalance(struct CBST* tree, struct CNode* curr);
+/* END Concurrent Binary Search Tree */
+
+#endif
@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "structs.h"
+#include "interfaces.h"
+
+# define DEMO_READERS 4
+# define DEMO_WRITES  100000
+
+
+void* searchWhileWriting(void* arg); /* Reader thread: counts lookups until the writes are done */
+
+struct CBST cbst;
+int writing = 1;
+int vals[25];
+int quantity;
+
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+int main(int argc, char const *argv[])
+{
+  pthread_t readers[DEMO_READERS];
+  struct CVersion version;
+  long lookups[DEMO_READERS];
+  FILE* file;
+  const char* fileName;
+  void* result;
+  int slot;
+  int i;
+
+  if (argc == 2)
+  {
+    fileName = argv[1];
+  }
+  else
+  {
+    fileName = "input.txt";
+  } 
+
+  file = fopen(fileName,"r");
+
+  printf("\n--------------------------------------------\n");
+
+  printf("\nHello! I'm here to generate simple visualizations of some basic data structures:\n");
+  printf("- Concurrent BST\n\n");
+
+  printf("Press ENTER to continue.\n\n");
+  getchar();
+
+  /* --------------------------------------------
+   *
+   *          Concurrent Binary Search Tree
+   * 
+   * --------------------------------------------
+   */
+
+  printf("Here are some Concurrent BST operations:\n\n");
+
+  initCBST(&cbst);
+
+  slot = joinCBST(&cbst);
+
+  printf("- isEmpty: %d\n\n", isEmptyCBST(&cbst));
+
+  printf("- Adding values from %s...\n\n", fileName);
+
+  quantity = 0;
+
+  while ( (quantity < 25) && (fscanf(file, "%d", &vals[quantity]) == 1) )
+  {
+    addCBST(&cbst, vals[quantity]);
+
+    quantity++;
+  }
+
+  printf("- isEmpty: %d\n\n", isEmptyCBST(&cbst));
+
+  printf("- contains {747}?: %d\n\n", containsCBST(&cbst, slot, 747));
+  printf("- contains {500}?: %d\n\n", containsCBST(&cbst, slot, 500));
+
+  printf("- Ready to print. Press ENTER.\n");
+  getchar();
+
+  printCBST(&cbst, slot);
+
+  printf("\n- Starting %d reader threads, while writing %d times...\n\n", DEMO_READERS, DEMO_WRITES);
+
+  for (i = 0; i < DEMO_READERS; i++)
+    pthread_create(&readers[i], NULL, searchWhileWriting, NULL);
+
+  for (i = 0; i < DEMO_WRITES; i++)
+  {
+
+    if (i % 2)
+    {
+      removeCBST(&cbst, 1000 + i / 2);
+    }
+    else
+    {
+      addCBST(&cbst, 1000 + i / 2);
+    }
+
+  }
+
+  __atomic_store_n(&writing, 0, __ATOMIC_SEQ_CST);
+
+  for (i = 0; i < DEMO_READERS; i++)
+  {
+    pthread_join(readers[i], &result);
+
+    lookups[i] = *(long*) result;
+
+    free(result);
+
+    printf("- Reader %d: %ld lookups during the writes\n", i, lookups[i]);
+  }
+
+  printf("\n- Taking a snapshot...\n");
+
+  snapshotCBST(&cbst, slot, &version);
+
+  printf("\n- removing {747}: %d\n", removeCBST(&cbst, 747));
+  printf("- removing {747}: %d\n\n", removeCBST(&cbst, 747));
+
+  printf("- contains {747}?: %d\n", containsCBST(&cbst, slot, 747));
+  printf("- snapshot contains {747}?: %d\n", containsVersionCBST(&version, 747));
+
+  printf("\n- Releasing the snapshot.\n");
+
+  releaseVersionCBST(&cbst, &version);
+
+  leaveCBST(&cbst, slot);
+
+  printf("\n");
+
+  printf("- Freeing Concurrent BST memory.\n");
+
+  freeCBST(&cbst);
+
+  /* --------------------------------------------
+   *
+   *        END Concurrent Binary Search Tree
+   * 
+   * --------------------------------------------
+   */
+
+  printf("\n--------------------------------------------\n");
+
+  fclose(file);
+  
+  return 0;
+}
+
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+void* searchWhileWriting(void* arg)
+{
+  /* Every value from the input file stays contained throughout the writes */
+
+  long* lookups = (long*) malloc(sizeof(long));
+  int slot = joinCBST(&cbst);
+  int i = 0;
+
+  (void) arg;
+
+  *lookups = 0;
+
+  while ( __atomic_load_n(&writing, __ATOMIC_SEQ_CST) )
+  {
+
+    if ( !containsCBST(&cbst, slot, vals[i]) )
+      printf("- Lost value {%d}!\n", vals[i]);
+
+    i = (i + 1) % quantity;
+
+    (*lookups)++;
+  }
+
+  leaveCBST(&cbst, slot);
+
+  return lookups;
+}
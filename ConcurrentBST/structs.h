@@ -0,0 +1,68 @@
+#ifndef __STRUCTS_H
+#define __STRUCTS_H
+
+# include <pthread.h>
+
+# ifndef TYPE
+# define TYPE      int
+# define TYPE_SIZE sizeof(int)
+# define EQ(a,b) (a == b)
+# define LT(a,b) (a < b)
+# endif
+
+# define CBST_MAX_HEIGHT 64  /* An AVL tree this tall needs more than 2^44 nodes */
+# define CBST_READERS    64  /* Reader slots, one per thread between joinCBST() and leaveCBST() */
+# define CBST_LINE       64  /* Cache line size: reader slots are padded to one each */
+
+/* A reader's announcement: 0 while idle, else (epoch << 1) | 1 while it searches.
+ * Each slot has its own cache line, so readers never write to a shared line. */
+struct CReader
+{
+  unsigned long state;
+  int taken;                  /* Handed out by joinCBST(), until leaveCBST() */
+  char pad[CBST_LINE - sizeof(unsigned long) - sizeof(int)];
+};
+
+/* Roots dropped in one epoch, freed (with the nodes only they reach) two epochs later. */
+struct CLimbo
+{
+  struct CNode** nodes;
+  int count;
+  int capacity;
+};
+
+struct CBST
+{
+  struct CNode* root;         /* Published version; replaced atomically by writers */
+  int size;
+
+  pthread_mutex_t writer;     /* Serializes addCBST() and removeCBST() */
+  unsigned long stamp;        /* Current write: nodes carrying it are private copies */
+
+  unsigned long epoch;
+  struct CLimbo limbo[3];
+
+  int readers;                /* Slots scanned for announcements: one past the highest ever taken */
+  struct CReader reader[CBST_READERS];
+};
+
+/* Never modified once reachable from a published root. */
+struct CNode
+{
+  struct CNode* left;
+  struct CNode* right;
+
+  TYPE val;
+  int height;
+
+  unsigned long stamp;        /* The write that created this node */
+  int refs;                   /* Parents pointing here, plus the tree or snapshots holding it as root */
+};
+
+/* A snapshot: one version of the tree, readable until released. */
+struct CVersion
+{
+  struct CNode* root;
+};
+
+#endif
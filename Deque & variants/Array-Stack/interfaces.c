@@ -0,0 +1,275 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+/* The Stack interfaces are implemented with the same API as the linked Stack, but the values are
+ * kept in one contiguous array, the first STACK_INLINE of them inside the Stack itself. */
+/* --------------------------------------------
+ *
+ *                    STACK
+ *
+ * Foundation used:   Dynamic array, with inline storage
+ *
+ * --------------------------------------------
+ */
+
+void initStack(struct Stack* s)
+{
+  /*  Description:
+   *    Function initializes a Stack structure using a pointer to its memory address.
+   *    The function does not allocate memory; the first STACK_INLINE values are stored in the
+   *    Stack's own inline array.
+   *
+   *  Parameters:
+   *    [struct]  (Stack*)  s   : A pointer to the Stack.
+   *
+   *  Pre-conditions:
+   *    - Pointer 's' points to a proper memory location.
+   *
+   *  Post-conditions:
+   *    - The Stack is initialized: the size is 0, and 'vals' points to the inline array.
+   */
+
+  assert(s);
+
+  s->vals = s->inlineVals;
+
+  s->size = 0;
+  s->capacity = STACK_INLINE;
+}
+
+void freeStack(struct Stack* s)
+{
+  /*  Description:
+   *    Function frees all allocated memory associated with the Stack, the heap array (if the Stack
+   *    ever outgrew its inline array).
+   *
+   *  Parameters:
+   *    [struct]  (Stack*)  s   : A pointer to the Stack.
+   *
+   *  Pre-conditions:
+   *    - Pointer 's' points to a proper memory location.
+   *    - The Stack was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Stack's memory is freed, and the Stack is left empty.
+   */
+
+  assert(s);
+
+  if (s->vals != s->inlineVals)
+  {
+    free(s->vals);
+  }
+
+  initStack(s);
+}
+
+int isEmptyStack(struct Stack* s)
+{
+  /*  Description:
+   *    Function checks the Stack's size and returns true or false.
+   *
+   *  Parameters:
+   *    [struct]  (Stack*)  s   : A pointer to the Stack.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True or False, if the structure is empty or not.
+   *
+   *  Pre-conditions:
+   *    - Pointer 's' points to a proper memory location.
+   *    - The Stack was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - True (1) or False (0) is returned.
+   */
+
+  assert(s);
+
+  if (s->size == 0)
+  {
+    return 1;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+int pushStack(struct Stack* s, TYPE val)
+{
+  /*  Description:
+   *    Function stores the given value on top of the Stack. Memory is only allocated when the array
+   *    is full, and then its capacity is doubled, so pushes cost amortized O(1).
+   *
+   *  Parameters:
+   *    [struct]  (Stack*)  s   : A pointer to the Stack.
+   *    [TYPE]              val : The value to insert.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was pushed, False if the array could not be grown.
+   *
+   *  Pre-conditions:
+   *    - Pointer 's' points to a proper memory location.
+   *    - The Stack was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The value is on top of the Stack, and the size is increased by 1; or, if memory ran out,
+   *      the Stack is unchanged and 0 is returned.
+   */
+
+  assert(s);
+
+  if ( (s->size == s->capacity) && !_growStack(s) )
+  {
+    return 0;
+  }
+
+  s->vals[s->size] = val;
+  s->size++;
+
+  return 1;
+}
+
+TYPE popStack(struct Stack* s)
+{
+  /*  Description:
+   *    Function removes the value on the top of the Stack and returns it. The array is not shrunk,
+   *    so a Stack that is pushed and popped at a steady depth does not allocate.
+   *
+   *  Parameters:
+   *    [struct]  (Stack*)  s   : A pointer to the Stack.
+   *
+   *  Returns:
+   *    [TYPE]    returnVal:      The value on the top of the Stack.
+   *
+   *  Pre-conditions:
+   *    - Pointer 's' points to a proper memory location.
+   *    - The Stack was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Stack's top element is removed.
+   *    - The Stack's top element value is returned, or 0 if the Stack is empty.
+   */
+
+  TYPE returnVal = 0;
+
+  assert(s);
+
+  if ( isEmptyStack(s) )
+  {
+    return returnVal;
+  }
+  else
+  {
+    s->size--;
+
+    returnVal = s->vals[s->size];
+
+    return returnVal;
+  }
+
+}
+
+TYPE peepStack(struct Stack* s)
+{
+  /*  Description:
+   *    Function accesses the value on the top of the Stack and returns the value.
+   *
+   *  Parameters:
+   *    [struct]  (Stack*)  s   : A pointer to the Stack.
+   *
+   *  Returns:
+   *    [TYPE]    returnVal:      The value on the top of the Stack.
+   *
+   *  Pre-conditions:
+   *    - Pointer 's' points to a proper memory location.
+   *    - The Stack was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Stack's top element value is returned, or 0 if the Stack is empty.
+   */
+
+  TYPE returnVal = 0;
+
+  assert(s);
+
+  if ( isEmptyStack(s) )
+  {
+    return returnVal;
+  }
+  else
+  {
+    returnVal = s->vals[s->size - 1];
+
+    return returnVal;
+  }
+
+}
+
+int _growStack(struct Stack* s)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Function doubles the Stack's capacity. The first time, the inline values are copied to a new
+   *    heap array; after that, the heap array is reallocated. The allocation result is checked, and
+   *    a request too large to express in bytes is refused, rather than asserted on.
+   *
+   *  Parameters:
+   *    [struct]  (Stack*)  s   : A pointer to the Stack.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the capacity was doubled, False if memory ran out.
+   *
+   *  Pre-conditions:
+   *    - Pointer 's' points to a proper memory location.
+   *    - The Stack was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The capacity is doubled and the values are unchanged; or the Stack is unchanged and 0 is returned.
+   */
+
+  TYPE* vals;
+  long capacity;
+
+  if ( (s->capacity > (LONG_MAX / 2)) || ((unsigned long) s->capacity > ((size_t) -1) / sizeof(TYPE) / 2) )
+  {
+    return 0;
+  }
+
+  capacity = s->capacity * 2;
+
+  if (s->vals == s->inlineVals)
+  {
+    vals = (TYPE*) malloc(sizeof(TYPE) * capacity);
+
+    if (vals == NULL)
+      return 0;
+
+    memcpy(vals, s->inlineVals, sizeof(TYPE) * s->size);
+  }
+  else
+  {
+    vals = (TYPE*) realloc(s->vals, sizeof(TYPE) * capacity);
+
+    if (vals == NULL)
+      return 0;
+  }
+
+  s->vals = vals;
+  s->capacity = capacity;
+
+  return 1;
+}
+
+/* --------------------------------------------
+ *
+ *                  END STACK
+ *
+ * --------------------------------------------
+ */
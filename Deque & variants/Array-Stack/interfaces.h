@@ -0,0 +1,16 @@
+#include "structs.h"
+
+#ifndef __INTERFACES_H
+#define __INTERFACES_H
+
+/* STACK */
+void initStack(struct Stack* s);
+void freeStack(struct Stack* s);
+int isEmptyStack(struct Stack* s);
+int pushStack(struct Stack* s, TYPE val);
+TYPE popStack(struct Stack* s);
+TYPE peepStack(struct Stack* s);
+int _growStack(struct Stack* s);
+/* END STACK */
+
+#endif
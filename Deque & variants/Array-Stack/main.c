@@ -0,0 +1,105 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "structs.h"
+#include "interfaces.h"
+
+
+int main(int argc, char const *argv[])
+{
+  struct Stack s;
+  FILE* file;
+  const char* fileName;
+  int val;
+  int count;
+  int quantity;
+
+  if (argc == 2)
+  {
+    fileName = argv[1];
+  }
+  else
+  {
+    fileName = "input.txt";
+  } 
+
+  file = fopen(fileName,"r");
+
+  printf("\n--------------------------------------------\n");
+
+  printf("\nHello! I'm here to generate simple visualizations of an array Stack.\n");
+  printf("The first %d values are held in the Stack itself.\n\n", STACK_INLINE);
+
+  printf("Press ENTER to continue.\n\n");
+  getchar();
+
+  /* --------------------------------------------
+   *
+   *                    STACK
+   * 
+   * --------------------------------------------
+   */
+
+  count = 0;
+  quantity = 25;
+
+  printf("Here are some Stack operations:\n\n");
+
+  initStack(&s);
+
+  printf("- isEmpty: %d\n\n", isEmptyStack(&s));
+
+  printf("- Adding values from %s...\n\n", fileName);
+
+  while ( !feof(file) && (quantity > 0) )
+  {
+    fscanf(file, "%d", &val);
+
+    if ( !pushStack(&s, val) )
+    {
+      printf("- Out of memory.\n");
+
+      break;
+    }
+
+    if (s.size == STACK_INLINE)
+    {
+      printf("- Inline array full at %d values.\n", STACK_INLINE);
+    }
+
+    quantity--;
+  }
+
+  printf("- Capacity: %ld (%s)\n\n", s.capacity, (s.vals == s.inlineVals) ? "inline" : "heap");
+
+  printf("- isEmpty: %d\n\n", isEmptyStack(&s));
+
+  printf("- Link-top: { %d }\n\n", peepStack(&s));
+
+  printf("- Ready to print. Press ENTER.\n");  
+  getchar();
+
+  while ( !isEmptyStack(&s) )
+  {
+    count++;
+    printf("- *POP* Link %d: { %d }\n", count, popStack(&s));
+  }
+
+  printf("\n");
+
+  printf("- Freeing Stack memory.\n");
+
+  freeStack(&s);
+
+  /* --------------------------------------------
+   *
+   *                  END STACK
+   * 
+   * --------------------------------------------
+   */
+
+  printf("\n--------------------------------------------\n");
+
+  fclose(file);
+  
+  return 0;
+}
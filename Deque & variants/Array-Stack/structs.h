@@ -0,0 +1,23 @@
+#ifndef __STRUCTS_H
+#define __STRUCTS_H
+
+# ifndef TYPE
+# define TYPE      int
+# define TYPE_SIZE sizeof(int)
+# endif
+
+# define STACK_INLINE 16  /* Values held in the Stack itself, before any allocation */
+
+/* 'vals' points at 'inlineVals' until the Stack outgrows it, then at a heap array that doubles
+ * as needed. Since 'vals' may point into the Stack, a Stack must not be copied by value. */
+struct Stack
+{
+  TYPE* vals;
+
+  long size;
+  long capacity;
+
+  TYPE inlineVals[STACK_INLINE];
+};
+
+#endif
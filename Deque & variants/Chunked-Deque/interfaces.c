@@ -0,0 +1,462 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+/* The Deque interfaces are implemented with the same API as the linked Deque, but the values are
+ * stored in fixed-size chunks rather than one Double-Link per value. */
+/* --------------------------------------------
+ *
+ *                    DEQUE
+ *
+ * Foundation used:   Ring buffer of chunks
+ *
+ * Sentinels:         None
+ *
+ * --------------------------------------------
+ */
+
+void initDeque(struct Deque* dq)
+{
+  /*  Description:
+   *    Function initializes a Deque structure using a pointer to its memory address.
+   *    No memory is allocated until the first value is added; the map of chunk pointers and the
+   *    chunks themselves are created on demand.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq  : A pointer to the Deque.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *
+   *  Post-conditions:
+   *    - The Deque is initialized: the size is 0 and there is no map.
+   */
+
+  assert(dq);
+
+  dq->chunks = NULL;
+  dq->chunkCount = 0;
+
+  dq->start = 0;
+  dq->size = 0;
+}
+
+void freeDeque(struct Deque* dq)
+{
+  /*  Description:
+   *    Function frees all allocated memory associated with the Deque, such as the chunks and the map.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq  : A pointer to the Deque.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Deque's memory is freed, and the Deque is left empty.
+   */
+
+  int i;
+
+  assert(dq);
+
+  for (i = 0; i < dq->chunkCount; i++)
+  {
+    free(dq->chunks[i]);
+  }
+
+  free(dq->chunks);
+
+  initDeque(dq);
+}
+
+void addFrontDeque(struct Deque* dq, TYPE val)
+{
+  /*  Description:
+   *    Function moves the start of the Deque back one slot and stores the given value there.
+   *    A chunk is only allocated when the slot lands in one that was never used.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq  : A pointer to the Deque.
+   *    [TYPE]              val : The value to insert.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The value is at the front of the Deque, and the size is increased by 1.
+   */
+
+  assert(dq);
+
+  if ( (dq->size + DEQUE_CHUNK) > (dq->chunkCount << DEQUE_CHUNK_SHIFT) )
+  {
+    _growDeque(dq);
+  }
+
+  dq->start = (dq->start - 1) & ((dq->chunkCount << DEQUE_CHUNK_SHIFT) - 1);
+
+  *_slotDeque(dq, dq->start) = val;
+
+  dq->size++;
+}
+
+void addBackDeque(struct Deque* dq, TYPE val)
+{
+  /*  Description:
+   *    Function stores the given value in the slot after the back of the Deque.
+   *    A chunk is only allocated when the slot lands in one that was never used.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq  : A pointer to the Deque.
+   *    [TYPE]              val : The value to insert.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The value is at the back of the Deque, and the size is increased by 1.
+   */
+
+  int slot;
+
+  assert(dq);
+
+  if ( (dq->size + DEQUE_CHUNK) > (dq->chunkCount << DEQUE_CHUNK_SHIFT) )
+  {
+    _growDeque(dq);
+  }
+
+  slot = (dq->start + dq->size) & ((dq->chunkCount << DEQUE_CHUNK_SHIFT) - 1);
+
+  *_slotDeque(dq, slot) = val;
+
+  dq->size++;
+}
+
+void printDeque(struct Deque* dq)
+{
+  /*  Description:
+   *    Function iterates through the Deque, starting at the front, and prints each corresponding value.
+   *    (Assuming an integer value.)
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq  : A pointer to the Deque.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Deque's values are printed to stdout.
+   */
+
+  int i;
+
+  assert(dq);
+
+  printf("Front to Back:\n\n");
+
+  for (i = 0; i < dq->size; i++)
+  {
+    printf("- Link %d: { %d }\n", (i + 1), getDeque(dq, i));
+  }
+
+}
+
+void removeFront(struct Deque* dq)
+{
+  /*  Description:
+   *    Function moves the start of the Deque forward one slot, dropping the front value.
+   *    Emptied chunks are kept in the map and reused when the ring wraps around to them.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq  : A pointer to the Deque.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The value at the front of the Deque is removed, if there is one.
+   */
+
+  assert(dq);
+
+  if ( isEmptyDeque(dq) )
+  {
+    return;
+  }
+  else
+  {
+    dq->start = (dq->start + 1) & ((dq->chunkCount << DEQUE_CHUNK_SHIFT) - 1);
+
+    dq->size--;
+  }
+
+}
+
+void removeBack(struct Deque* dq)
+{
+  /*  Description:
+   *    Function drops the value at the back of the Deque.
+   *    Emptied chunks are kept in the map and reused when the ring wraps around to them.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq  : A pointer to the Deque.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The value at the back of the Deque is removed, if there is one.
+   */
+
+  assert(dq);
+
+  if ( isEmptyDeque(dq) )
+  {
+    return;
+  }
+  else
+  {
+    dq->size--;
+  }
+
+}
+
+int isEmptyDeque(struct Deque* dq)
+{
+  /*  Description:
+   *    Function checks the Deque's size and returns true or false.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq  : A pointer to the Deque.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True or False, if the structure is empty or not.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - True (1) or False (0) is returned.
+   */
+
+  assert(dq);
+
+  if (dq->size == 0)
+  {
+    return 1;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+TYPE front(struct Deque* dq)
+{
+  /*  Description:
+   *    Function accesses the value at the front of the Deque and returns it.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq  : A pointer to the Deque.
+   *
+   *  Returns:
+   *    [TYPE]    returnVal:      The value at the front of the Deque.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Deque's front element value is returned, or 0 if the Deque is empty.
+   */
+
+  TYPE returnVal = 0;
+
+  assert(dq);
+
+  if ( isEmptyDeque(dq) )
+  {
+    return returnVal;
+  }
+  else
+  {
+    returnVal = getDeque(dq, 0);
+
+    return returnVal;
+  }
+
+}
+
+TYPE back(struct Deque* dq)
+{
+  /*  Description:
+   *    Function accesses the value at the back of the Deque and returns it.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq  : A pointer to the Deque.
+   *
+   *  Returns:
+   *    [TYPE]    returnVal:      The value at the back of the Deque.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Deque's back element value is returned, or 0 if the Deque is empty.
+   */
+
+  TYPE returnVal = 0;
+
+  assert(dq);
+
+  if ( isEmptyDeque(dq) )
+  {
+    return returnVal;
+  }
+  else
+  {
+    returnVal = getDeque(dq, (dq->size - 1));
+
+    return returnVal;
+  }
+
+}
+
+TYPE getDeque(struct Deque* dq, int index)
+{
+  /*  Description:
+   *    Function accesses the value at the given position, counting from the front of the Deque, and returns it.
+   *    The slot is found with one mask and one shift, without walking the Deque.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq    : A pointer to the Deque.
+   *    [int]               index : The position of the value, where 0 is the front.
+   *
+   *  Returns:
+   *    [TYPE]    The value at the given position.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly.
+   *    - 0 <= index < size.
+   *
+   *  Post-conditions:
+   *    - The value at the given position is returned.
+   */
+
+  int slot;
+
+  assert(dq);
+  assert( (index >= 0) && (index < dq->size) );
+
+  slot = (dq->start + index) & ((dq->chunkCount << DEQUE_CHUNK_SHIFT) - 1);
+
+  return dq->chunks[slot >> DEQUE_CHUNK_SHIFT][slot & (DEQUE_CHUNK - 1)];
+}
+
+TYPE* _slotDeque(struct Deque* dq, int slot)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Function returns the address of the given slot of the ring, allocating its chunk if the
+   *    chunk was never used.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq    : A pointer to the Deque.
+   *    [int]               slot  : The slot of the ring.
+   *
+   *  Returns:
+   *    [TYPE*]   The address of the slot.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly, and has a map.
+   *    - There is memory available to allocate.
+   *
+   *  Post-conditions:
+   *    - The slot's chunk exists, and the slot's address is returned.
+   */
+
+  TYPE** chunk;
+
+  chunk = &dq->chunks[slot >> DEQUE_CHUNK_SHIFT];
+
+  if (*chunk == NULL)
+  {
+    *chunk = (TYPE*) malloc(sizeof(TYPE) * DEQUE_CHUNK);
+
+    assert(*chunk);
+  }
+
+  return (*chunk) + (slot & (DEQUE_CHUNK - 1));
+}
+
+void _growDeque(struct Deque* dq)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Function doubles the map of chunk pointers. The chunks are copied over in ring order, starting
+   *    with the front value's chunk, so the values keep their order without being moved themselves.
+   *    The map is grown while a whole chunk's worth of slots is still free, so the front and back
+   *    values never share a chunk and the ring can be cut at a chunk boundary.
+   *
+   *  Parameters:
+   *    [struct]  (Deque*)  dq  : A pointer to the Deque.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'dq' points to a proper memory location.
+   *    - The Deque was initialized correctly.
+   *    - There is memory available to allocate.
+   *
+   *  Post-conditions:
+   *    - The map holds twice as many chunk pointers (or DEQUE_MAP_MIN on the first call), and
+   *      the Deque's values are unchanged.
+   */
+
+  TYPE** chunks;
+  int count, first, i;
+
+  count = (dq->chunkCount == 0) ? DEQUE_MAP_MIN : (dq->chunkCount * 2);
+
+  chunks = (TYPE**) malloc(sizeof(TYPE*) * count);
+
+  assert(chunks);
+
+  first = dq->start >> DEQUE_CHUNK_SHIFT;
+
+  for (i = 0; i < dq->chunkCount; i++)
+  {
+    chunks[i] = dq->chunks[(first + i) & (dq->chunkCount - 1)];
+  }
+
+  for (; i < count; i++)
+  {
+    chunks[i] = NULL;
+  }
+
+  free(dq->chunks);
+
+  dq->chunks = chunks;
+  dq->chunkCount = count;
+  dq->start = dq->start & (DEQUE_CHUNK - 1);
+}
+
+/* --------------------------------------------
+ *
+ *                  END DEQUE
+ *
+ * --------------------------------------------
+ */
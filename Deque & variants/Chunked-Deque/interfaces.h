@@ -0,0 +1,22 @@
+#include "structs.h"
+
+#ifndef __INTERFACES_H
+#define __INTERFACES_H
+
+/* DEQUE */
+void initDeque(struct Deque* dq);
+void freeDeque(struct Deque* dq);
+void addFrontDeque(struct Deque* dq, TYPE val);
+void addBackDeque(struct Deque* dq, TYPE val);
+void printDeque(struct Deque* dq);
+void removeFront(struct Deque* dq);
+void removeBack(struct Deque* dq);
+int isEmptyDeque(struct Deque* dq);
+TYPE front(struct Deque* dq);
+TYPE back(struct Deque* dq);
+TYPE getDeque(struct Deque* dq, int index);
+TYPE* _slotDeque(struct Deque* dq, int slot);
+void _growDeque(struct Deque* dq);
+/* END DEQUE */
+
+#endif
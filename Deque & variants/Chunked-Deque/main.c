@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "structs.h"
+#include "interfaces.h"
+
+
+int main(int argc, char const *argv[])
+{
+  struct Deque dq;
+  FILE* file;
+  const char* fileName;
+  int val;
+  int count;
+  int quantity;
+
+  if (argc == 2)
+  {
+    fileName = argv[1];
+  }
+  else
+  {
+    fileName = "input.txt";
+  } 
+
+  file = fopen(fileName,"r");
+
+  printf("\n--------------------------------------------\n");
+
+  printf("\nHello! I'm here to generate simple visualizations of a chunked Deque.\n");
+  printf("Values are stored %d to a chunk, in a ring that grows at both ends.\n\n", DEQUE_CHUNK);
+
+  printf("Press ENTER to continue.\n\n");
+  getchar();
+
+  /* --------------------------------------------
+   *
+   *                    DEQUE
+   * 
+   * --------------------------------------------
+   */
+
+  count = 0;
+  quantity = 25;
+
+  printf("Here are some Deque operations:\n\n");
+
+  initDeque(&dq);
+
+  printf("- isEmpty: %d\n\n", isEmptyDeque(&dq));
+
+  printf("- Adding values from %s, alternating front and back...\n\n", fileName);
+
+  while ( !feof(file) && (quantity > 0) )
+  {
+    fscanf(file, "%d", &val);
+
+    if (count % 2 == 0)
+    {
+      addFrontDeque(&dq, val);
+    }
+    else
+    {
+      addBackDeque(&dq, val);
+    }
+
+    count++;
+    quantity--;
+  }
+
+  printf("- isEmpty: %d\n\n", isEmptyDeque(&dq));
+
+  printf("- Ready to print. Press ENTER.\n");
+  getchar();
+
+  printDeque(&dq);
+
+  printf("\n");
+
+  printf("- Link-front: { %d }\n", front(&dq));
+
+  printf("- Link-back:  { %d }\n", back(&dq));
+
+  printf("- Link %d (by index): { %d }\n\n", (dq.size / 2) + 1, getDeque(&dq, dq.size / 2));
+
+  printf("- Removing 5 values from each end.\n\n");
+
+  for (count = 0; count < 5; count++)
+  {
+    removeFront(&dq);
+    removeBack(&dq);
+  }
+
+  printf("- Link-front: { %d }\n", front(&dq));
+
+  printf("- Link-back:  { %d }\n", back(&dq));
+
+  printf("- Freeing Deque memory.\n");  
+
+  freeDeque(&dq);
+
+  /* --------------------------------------------
+   *
+   *                  END DEQUE
+   * 
+   * --------------------------------------------
+   */
+
+  printf("\n--------------------------------------------\n");
+
+  fclose(file);
+  
+  return 0;
+}
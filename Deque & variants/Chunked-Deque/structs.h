@@ -0,0 +1,25 @@
+#ifndef __STRUCTS_H
+#define __STRUCTS_H
+
+# ifndef TYPE
+# define TYPE      int
+# define TYPE_SIZE sizeof(int)
+# endif
+
+# define DEQUE_CHUNK_SHIFT 7                        /* Values per chunk: 2^7 */
+# define DEQUE_CHUNK       (1 << DEQUE_CHUNK_SHIFT)
+# define DEQUE_MAP_MIN     8                        /* Chunk pointers in the first map */
+
+/* A ring buffer of chunkCount * DEQUE_CHUNK slots, stored as fixed-size chunks of values
+ * reached through a map of chunk pointers; the values are the 'size' slots from 'start' on,
+ * wrapping around. 'chunkCount' is a power of 2, so a slot is found with masks and shifts. */
+struct Deque
+{
+  TYPE** chunks;
+  int chunkCount;
+
+  int start;
+  int size;
+};
+
+#endif
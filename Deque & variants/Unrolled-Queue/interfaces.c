@@ -0,0 +1,378 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+/* The Queue interfaces are implemented with the same API as the linked Queue, but each link holds a
+ * cache line of values rather than one. */
+/* --------------------------------------------
+ *
+ *                   QUEUE
+ *
+ * Foundation used:   Unrolled-Link
+ *
+ * Sentinels:         None
+ *
+ * --------------------------------------------
+ */
+
+void initQueue(struct Queue* q)
+{
+  /*  Description:
+   *    Function initializes a Queue structure using a pointer to its memory address.
+   *    No memory is allocated until the first value is added.
+   *
+   *  Parameters:
+   *    [struct]  (Queue*)  q   : A pointer to the Queue.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'q' points to a proper memory location.
+   *
+   *  Post-conditions:
+   *    - The Queue is initialized: the size is 0, and there are no Unrolled-Links.
+   */
+
+  assert(q);
+
+  q->head = NULL;
+  q->tail = NULL;
+
+  q->spare = NULL;
+  q->spareCount = 0;
+
+  q->size = 0;
+}
+
+void freeQueue(struct Queue* q)
+{
+  /*  Description:
+   *    Function frees all allocated memory associated with the Queue, such as the Unrolled-Links
+   *    in use and the spare ones.
+   *
+   *  Parameters:
+   *    [struct]  (Queue*)  q   : A pointer to the Queue.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'q' points to a proper memory location.
+   *    - The Queue was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Queue's memory is freed, and the Queue is left empty.
+   */
+
+  struct ULink* curr, * temp;
+
+  assert(q);
+
+  curr = q->head;
+
+  while (curr)
+  {
+    temp = curr;
+
+    curr = curr->next;
+
+    free(temp);
+  }
+
+  curr = q->spare;
+
+  while (curr)
+  {
+    temp = curr;
+
+    curr = curr->next;
+
+    free(temp);
+  }
+
+  initQueue(q);
+}
+
+void addQueue(struct Queue* q, TYPE val)
+{
+  /*  Description:
+   *    Function appends the given value to the end of the Queue. A new Unrolled-Link is only
+   *    linked in when the tail link is full, so one in QUEUE_LINK_VALS calls allocates at most.
+   *
+   *  Parameters:
+   *    [struct]  (Queue*)  q   : A pointer to the Queue.
+   *    [TYPE]              val : The value to insert.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'q' points to a proper memory location.
+   *    - The Queue was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The value is at the end of the Queue, and the size is increased by 1.
+   */
+
+  struct ULink* link;
+
+  assert(q);
+
+  if ( (q->tail == NULL) || (q->tail->last == QUEUE_LINK_VALS) )
+  {
+    link = _newULink(q);
+
+    if (q->tail)
+      q->tail->next = link;
+    else
+      q->head = link;
+
+    q->tail = link;
+  }
+
+  q->tail->vals[q->tail->last] = val;
+  q->tail->last++;
+
+  q->size++;
+}
+
+void printQueue(struct Queue* q)
+{
+  /*  Description:
+   *    Function iterates through the Queue, starting at the front, and prints each corresponding value.
+   *    (Assuming an integer value.)
+   *
+   *  Parameters:
+   *    [struct]  (Queue*)  q   : A pointer to the Queue.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'q' points to a proper memory location.
+   *    - The Queue was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Queue's values are printed to stdout.
+   */
+
+  struct ULink* curr;
+  int count = 0;
+  int i;
+
+  assert(q);
+
+  printf("Front to Back:\n\n");
+
+  curr = q->head;
+
+  while (curr)
+  {
+    for (i = curr->first; i < curr->last; i++)
+    {
+      count++;
+
+      printf("- Link %d: { %d }\n", count, curr->vals[i]);
+    }
+
+    curr = curr->next;
+  }
+
+}
+
+void removeQueue(struct Queue* q)
+{
+  /*  Description:
+   *    Function drops the value at the front of the Queue. When that empties the front Unrolled-Link,
+   *    the link is unlinked and kept as a spare; if it was the only link, it is simply rewound.
+   *
+   *  Parameters:
+   *    [struct]  (Queue*)  q   : A pointer to the Queue.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'q' points to a proper memory location.
+   *    - The Queue was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The value at the front of the Queue is removed, if there is one.
+   *      Correct linkages are maintained.
+   */
+
+  struct ULink* curr;
+
+  assert(q);
+
+  if ( isEmptyQueue(q) )
+  {
+    return;
+  }
+  else
+  {
+    curr = q->head;
+
+    curr->first++;
+
+    if (curr->first == curr->last)
+    {
+      if (curr == q->tail)
+      {
+        curr->first = 0;
+        curr->last = 0;
+      }
+      else
+      {
+        q->head = curr->next;
+
+        _freeULink(q, curr);
+      }
+    }
+
+    q->size--;
+  }
+
+}
+
+int isEmptyQueue(struct Queue* q)
+{
+  /*  Description:
+   *    Function checks the Queue's size and returns true or false.
+   *
+   *  Parameters:
+   *    [struct]  (Queue*)  q   : A pointer to the Queue.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True or False, if the structure is empty or not.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'q' points to a proper memory location.
+   *    - The Queue was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - True (1) or False (0) is returned.
+   */
+
+  assert(q);
+
+  if (q->size == 0)
+  {
+    return 1;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+TYPE frontQueue(struct Queue* q)
+{
+  /*  Description:
+   *    Function accesses the value at the front of the Queue and returns it.
+   *
+   *  Parameters:
+   *    [struct]  (Queue*)  q   : A pointer to the Queue.
+   *
+   *  Returns:
+   *    [TYPE]    returnVal:      The value at the front of the Queue.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'q' points to a proper memory location.
+   *    - The Queue was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Queue's front element value is returned, or 0 if the Queue is empty.
+   */
+
+  TYPE returnVal = 0;
+
+  assert(q);
+
+  if ( isEmptyQueue(q) )
+  {
+    return returnVal;
+  }
+  else
+  {
+    returnVal = q->head->vals[q->head->first];
+
+    return returnVal;
+  }
+
+}
+
+struct ULink* _newULink(struct Queue* q)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Function takes an Unrolled-Link from the spares, or allocates one if there are none, and
+   *    returns it empty and unlinked.
+   *
+   *  Parameters:
+   *    [struct]  (Queue*)  q   : A pointer to the Queue.
+   *
+   *  Returns:
+   *    [struct]  (ULink*)  link: The empty Unrolled-Link.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'q' points to a proper memory location.
+   *    - The Queue was initialized correctly.
+   *    - There is memory available to allocate, if there are no spares.
+   *
+   *  Post-conditions:
+   *    - An empty Unrolled-Link is returned.
+   */
+
+  struct ULink* link;
+
+  if (q->spare)
+  {
+    link = q->spare;
+
+    q->spare = link->next;
+    q->spareCount--;
+  }
+  else
+  {
+    link = (struct ULink*) malloc(sizeof(struct ULink));
+
+    assert(link);
+  }
+
+  link->next = NULL;
+  link->first = 0;
+  link->last = 0;
+
+  return link;
+}
+
+void _freeULink(struct Queue* q, struct ULink* link)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Function keeps an emptied Unrolled-Link as a spare, or frees it if QUEUE_SPARE_MAX are
+   *    already kept. A few spares absorb the churn of a Queue that drains and refills around a
+   *    link boundary, without holding on to the memory of a Queue that was once long.
+   *
+   *  Parameters:
+   *    [struct]  (Queue*)  q     : A pointer to the Queue.
+   *    [struct]  (ULink*)  link  : The emptied Unrolled-Link, already unlinked.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'q' points to a proper memory location.
+   *    - The Queue was initialized correctly.
+   *
+   *  Post-conditions:
+   *    - The Unrolled-Link is a spare, or its memory is freed.
+   */
+
+  if (q->spareCount < QUEUE_SPARE_MAX)
+  {
+    link->next = q->spare;
+
+    q->spare = link;
+    q->spareCount++;
+  }
+  else
+  {
+    free(link);
+  }
+
+}
+
+/* --------------------------------------------
+ *
+ *                  END QUEUE
+ *
+ * --------------------------------------------
+ */
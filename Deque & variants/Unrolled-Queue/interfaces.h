@@ -0,0 +1,18 @@
+#include "structs.h"
+
+#ifndef __INTERFACES_H
+#define __INTERFACES_H
+
+/* QUEUE */
+void initQueue(struct Queue* q);
+void freeQueue(struct Queue* q);
+void addQueue(struct Queue* q, TYPE val);
+void printQueue(struct Queue* q);
+void removeQueue(struct Queue* q);
+int isEmptyQueue(struct Queue* q);
+TYPE frontQueue(struct Queue* q);
+struct ULink* _newULink(struct Queue* q);
+void _freeULink(struct Queue* q, struct ULink* link);
+/* END QUEUE */
+
+#endif
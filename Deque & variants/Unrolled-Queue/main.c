@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "structs.h"
+#include "interfaces.h"
+
+
+int main(int argc, char const *argv[])
+{
+  struct Queue q;
+  FILE* file;
+  const char* fileName;
+  int val;
+  int count;
+  int quantity;
+
+  if (argc == 2)
+  {
+    fileName = argv[1];
+  }
+  else
+  {
+    fileName = "input.txt";
+  } 
+
+  file = fopen(fileName,"r");
+
+  printf("\n--------------------------------------------\n");
+
+  printf("\nHello! I'm here to generate simple visualizations of an unrolled Queue.\n");
+  printf("Each link holds up to %d values.\n\n", (int) QUEUE_LINK_VALS);
+
+  printf("Press ENTER to continue.\n\n");
+  getchar();
+
+  /* --------------------------------------------
+   *
+   *                   QUEUE
+   * 
+   * --------------------------------------------
+   */
+
+  quantity = 25;
+
+  printf("Here are some Queue operations:\n\n");
+
+  initQueue(&q);
+
+  printf("- isEmpty: %d\n\n", isEmptyQueue(&q));
+
+  printf("- Adding values from %s...\n\n", fileName);
+
+  while ( !feof(file) && (quantity > 0) )
+  {
+    fscanf(file, "%d", &val);
+
+    addQueue(&q, val);
+
+    quantity--;
+  }
+
+  printf("- isEmpty: %d\n\n", isEmptyQueue(&q));
+
+  printf("- Ready to print. Press ENTER.\n");  
+  getchar();
+
+  printQueue(&q);
+
+  printf("\n");
+
+  printf("- Link-front: { %d }\n\n", frontQueue(&q));
+
+  printf("- Removing %d values, emptying the first link.\n\n", (int) QUEUE_LINK_VALS);
+
+  for (count = 0; count < (int) QUEUE_LINK_VALS; count++)
+  {
+    removeQueue(&q);
+  }
+
+  printf("- Link-front: { %d }\n", frontQueue(&q));
+
+  printf("- Spare links: %d\n", q.spareCount);
+
+  printf("- Freeing Queue memory.\n");
+
+  freeQueue(&q);
+
+  /* --------------------------------------------
+   *
+   *                  END QUEUE
+   * 
+   * --------------------------------------------
+   */
+
+  printf("\n--------------------------------------------\n");
+
+  fclose(file);
+  
+  return 0;
+}
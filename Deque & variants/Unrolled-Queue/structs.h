@@ -0,0 +1,35 @@
+#ifndef __STRUCTS_H
+#define __STRUCTS_H
+
+# ifndef TYPE
+# define TYPE      int
+# define TYPE_SIZE sizeof(int)
+# endif
+
+# define QUEUE_LINE_BYTES 64                              /* Cache line size */
+# define QUEUE_LINK_VALS  (QUEUE_LINE_BYTES / TYPE_SIZE)  /* Values per Unrolled-Link */
+# define QUEUE_SPARE_MAX  4                               /* Emptied Unrolled-Links kept for reuse */
+
+/* An Unrolled-Link holds a line of values; the live ones are vals[first] up to (not including) vals[last]. */
+struct ULink
+{
+  struct ULink* next;
+
+  int first;
+  int last;
+
+  TYPE vals[QUEUE_LINK_VALS];
+};
+
+struct Queue
+{
+  struct ULink* head;
+  struct ULink* tail;
+
+  struct ULink* spare;
+  int spareCount;
+
+  int size;
+};
+
+#endif
@@ -1,9 +1,15 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include "structs.h"
 #include "interfaces.h"
 
+#if defined(__GNUC__) && defined(__x86_64__)
+# define HASH_AVX2
+# include <immintrin.h>
+#endif
+
 int stringHash(char* str)
 {
 
@@ -20,6 +26,133 @@ int stringHash(char* str)
   return hash;
 }
 
+void _stringHashLanesScalar(KeyType* keys, int* hashes)
+{
+  int lane;
+
+  for (lane = 0; lane < HASH_LANES; lane++)
+    hashes[lane] = stringHash(keys[lane]);
+
+}
+
+#ifdef HASH_AVX2
+__attribute__((target("avx2")))
+void _stringHashLanesAVX2(KeyType* keys, int* hashes)
+{
+
+  /* DJB HASH, one key per 32-bit lane.
+   * Four bytes are folded per step, using hash * 33^4 + c0 * 33^3 + c1 * 33^2 + c2 * 33 + c3,
+   * so the lanes share one multiply chain. The last 0-3 bytes of each key are folded one by one.
+   * Lanes that ran out of input keep their hash (blend) until the longest key is done. */
+
+  int lane;
+  int step;
+  int maxChunks;
+  int maxTail;
+  int len[HASH_LANES];
+  int word[HASH_LANES];
+  __m256i hash;
+  __m256i next;
+  __m256i chunks;
+  __m256i tails;
+  __m256i live;
+  __m256i addrLo;
+  __m256i addrHi;
+
+  maxChunks = 0;
+  maxTail = 0;
+
+  for (lane = 0; lane < HASH_LANES; lane++)
+  {
+    len[lane] = (int) strlen(keys[lane]);
+
+    if (len[lane] / 4 > maxChunks)
+      maxChunks = len[lane] / 4;
+
+    if ( (len[lane] & 3) > maxTail )
+      maxTail = len[lane] & 3;
+
+  }
+
+  chunks = _mm256_srai_epi32(_mm256_loadu_si256((__m256i*) len), 2);
+  tails = _mm256_and_si256(_mm256_loadu_si256((__m256i*) len), _mm256_set1_epi32(3));
+
+  hash = _mm256_set1_epi32(5381);
+
+  addrLo = _mm256_loadu_si256((__m256i*) keys);
+  addrHi = _mm256_loadu_si256((__m256i*) (keys + 4));
+
+  for (step = 0; step < maxChunks; step++)
+  {
+    live = _mm256_cmpgt_epi32(chunks, _mm256_set1_epi32(step));
+
+    /* Masked gathers: lanes without a whole chunk left are not read at all */
+    next = _mm256_set_m128i(
+             _mm256_mask_i64gather_epi32(_mm_setzero_si128(), (int*) 0, addrHi, _mm256_extracti128_si256(live, 1), 1),
+             _mm256_mask_i64gather_epi32(_mm_setzero_si128(), (int*) 0, addrLo, _mm256_castsi256_si128(live), 1));
+
+    addrLo = _mm256_add_epi64(addrLo, _mm256_set1_epi64x(4));
+    addrHi = _mm256_add_epi64(addrHi, _mm256_set1_epi64x(4));
+
+    /* Sign-extended bytes, first character in the low byte */
+    next = _mm256_add_epi32(
+             _mm256_add_epi32(
+               _mm256_mullo_epi32(_mm256_srai_epi32(_mm256_slli_epi32(next, 24), 24), _mm256_set1_epi32(35937)),
+               _mm256_mullo_epi32(_mm256_srai_epi32(_mm256_slli_epi32(next, 16), 24), _mm256_set1_epi32(1089))),
+             _mm256_add_epi32(
+               _mm256_mullo_epi32(_mm256_srai_epi32(_mm256_slli_epi32(next, 8), 24), _mm256_set1_epi32(33)),
+               _mm256_srai_epi32(next, 24)));
+
+    next = _mm256_add_epi32(_mm256_mullo_epi32(hash, _mm256_set1_epi32(1185921)), next);
+    hash = _mm256_blendv_epi8(hash, next, live);
+  }
+
+  for (step = 0; step < maxTail; step++)
+  {
+
+    for (lane = 0; lane < HASH_LANES; lane++)
+    {
+      word[lane] = 0;
+
+      if (step < (len[lane] & 3))
+        word[lane] = keys[lane][ (len[lane] & ~3) + step ];
+
+    }
+
+    next = _mm256_set_epi32(word[7], word[6], word[5], word[4], word[3], word[2], word[1], word[0]);
+    next = _mm256_add_epi32( _mm256_add_epi32(_mm256_slli_epi32(hash, 5), hash), next );
+    live = _mm256_cmpgt_epi32(tails, _mm256_set1_epi32(step));
+    hash = _mm256_blendv_epi8(hash, next, live);
+  }
+
+  _mm256_storeu_si256((__m256i*) hashes, hash);
+}
+#endif
+
+void stringHashMany(KeyType* keys, int* hashes, int n)
+{
+  static void (*lanes)(KeyType*, int*) = NULL;
+  int i;
+
+  /* Pick the lane kernel once, on first use */
+  if (!lanes)
+  {
+    lanes = _stringHashLanesScalar;
+
+#ifdef HASH_AVX2
+    if ( __builtin_cpu_supports("avx2") )
+      lanes = _stringHashLanesAVX2;
+#endif
+  }
+
+  for (i = 0; i + HASH_LANES <= n; i += HASH_LANES)
+    lanes(keys + i, hashes + i);
+
+  for (; i < n; i++)
+    hashes[i] = stringHash(keys[i]);
+
+}
+
 void initTable (hashTable* ht, int tableSize)
 {
   int index;
@@ -107,6 +240,11 @@ void freeTableBody(hashLink** htb, int oldSize)
 }
 
 void insertTable(hashTable* ht, KeyType key, ValueType val)
+{
+  _insertHashed(ht, key, val, stringHash(key));
+}
+
+void _insertHashed(hashTable* ht, KeyType key, ValueType val, int keyHash)
 {
   int index;
   hashLink* htLink;
@@ -118,7 +256,7 @@ void insertTable(hashTable* ht, KeyType key, ValueType val)
   htLink->key = key;
   htLink->val = val;
 
-  index = (int)(labs( stringHash(key) ) % ht->tableSize);
+  index = (int)(labs( keyHash ) % ht->tableSize);
 
   htLink->next = ht->table[index];
 
@@ -127,6 +265,28 @@ void insertTable(hashTable* ht, KeyType key, ValueType val)
   ht->count++;
 }
 
+void insertManyTable(hashTable* ht, KeyType* keys, ValueType* vals, int n)
+{
+  int i;
+  int j;
+  int batch;
+  int hashes[HASH_BATCH];
+
+  assert(ht);
+
+  for (i = 0; i < n; i += HASH_BATCH)
+  {
+    batch = (n - i < HASH_BATCH) ? (n - i) : HASH_BATCH;
+
+    stringHashMany(keys + i, hashes, batch);
+
+    for (j = 0; j < batch; j++)
+      _insertHashed(ht, keys[i + j], vals[i + j], hashes[j]);
+
+  }
+
+}
+
 void removeKey(hashTable* ht, KeyType key)
 {
   int index;
@@ -190,6 +350,103 @@ void removeKey(hashTable* ht, KeyType key)
 
 }
 
+int removeIfTable(hashTable* ht, int (*pred)(KeyType, ValueType, void*), void* ctx)
+{
+  int i;
+  int removed;
+  hashLink** link;
+  hashLink* rmv;
+
+  assert(ht);
+  assert(pred);
+
+  removed = 0;
+
+  /* One pass over every chain: unlink through the pointer that points at each match,
+   * so no key is re-hashed and no chain is walked twice. */
+  for (i = 0; i < ht->tableSize; i++)
+  {
+    link = &ht->table[i];
+
+    while (*link)
+    {
+
+      if ( pred((*link)->key, (*link)->val, ctx) )
+      {
+        rmv = *link;
+        *link = rmv->next;
+
+        free(rmv->key);
+        free(rmv);
+
+        removed++;
+      }
+      else
+      {
+        link = &(*link)->next;
+      }
+
+    }
+
+  }
+
+  ht->count -= removed;
+
+  return removed;
+}
+
+void shrinkTable(hashTable* ht)
+{
+  int i;
+  int index;
+  int newSize;
+  hashLink** newTable;
+  hashLink* curr;
+  hashLink* next;
+
+  assert(ht);
+
+  /* Halve while the load would stay under 1/2 */
+  newSize = ht->tableSize;
+
+  while ( (newSize > 1) && (ht->count < newSize / 4) )
+    newSize /= 2;
+
+  if (newSize == ht->tableSize)
+    return;
+
+  newTable = (hashLink**) malloc(sizeof(hashLink*) * newSize);
+
+  assert(newTable);
+
+  for (i = 0; i < newSize; i++)
+    newTable[i] = NULL;
+
+  /* Existing links are moved over as-is, unlike _resizeTable() which re-allocates them */
+  for (i = 0; i < ht->tableSize; i++)
+  {
+    curr = ht->table[i];
+
+    while (curr)
+    {
+      next = curr->next;
+
+      index = (int)(labs( stringHash(curr->key) ) % newSize);
+
+      curr->next = newTable[index];
+      newTable[index] = curr;
+
+      curr = next;
+    }
+
+  }
+
+  free(ht->table);
+
+  ht->table = newTable;
+  ht->tableSize = newSize;
+}
+
 void printTable(hashTable* ht)
 {
   int i;
@@ -360,17 +617,42 @@ float tableLoad(hashTable* ht)
 }
 
 struct hashLink* findLink(hashTable* ht, KeyType key)
+{
+  assert(ht);
+
+  return _findHashed(ht, stringHash(key));
+}
+
+void containsManyKeys(hashTable* ht, KeyType* keys, int* out, int n)
+{
+  int i;
+  int j;
+  int batch;
+  int hashes[HASH_BATCH];
+
+  assert(ht);
+
+  for (i = 0; i < n; i += HASH_BATCH)
+  {
+    batch = (n - i < HASH_BATCH) ? (n - i) : HASH_BATCH;
+
+    stringHashMany(keys + i, hashes, batch);
+
+    for (j = 0; j < batch; j++)
+      out[i + j] = _findHashed(ht, hashes[j]) ? 1 : 0;
+
+  }
+
+}
+
+struct hashLink* _findHashed(hashTable* ht, int paramKeyHash)
 {
   int index;
   int htKeyHash;
-  int paramKeyHash;
   struct hashLink* htLink;
   struct hashLink* htLinkNxt;
 
-  assert(ht);
-
-  index = (int)(labs( stringHash(key) ) % ht->tableSize);
-  paramKeyHash = stringHash(key);
+  index = (int)(labs( paramKeyHash ) % ht->tableSize);
 
   if (ht->table[index])
   {
@@ -436,4 +718,482 @@ void _resizeTable(hashTable* ht)
   }
 
   freeTableBody(oldTable, oldSize);
-}
\ No newline at end of file
+}
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+/* FROZEN TABLE
+ *
+ * A read-only snapshot of a hashTable, built with a minimal perfect hash
+ * (PTHash-style: keys are split into small buckets, and each bucket gets a
+ * 'pilot' that scatters its keys into free slots). Every key owns exactly one
+ * slot, so a lookup is a single probe with no chains.
+ *
+ * Pilots scatter keys over slightly more slots than keys (slotCount), which
+ * keeps the last buckets' pilot search short enough for 16-bit pilots. The few
+ * keys that land past 'count' are remapped into the free slots below it.
+ *
+ * Like the hashTable, keys are identified by their stringHash. The key strings
+ * are dropped, and each slot keeps only a FROZEN_PRINT_BITS fingerprint of the
+ * hash, so a key that was never in the table is reported present 1 time in
+ * 2^FROZEN_PRINT_BITS (1 in 256 by default). Callers that need an exact answer
+ * for absent keys should build with a wider fingerprint, or check the hashTable. */
+
+unsigned int _mixHash(unsigned int h)
+{
+
+  /* MURMUR3 FINALIZER */
+
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+
+  return h;
+}
+
+int _frozenBucket(frozenTable* ft, unsigned int hash)
+{
+  return (int)( _mixHash(hash ^ ft->seed) % (unsigned int)ft->bucketCount );
+}
+
+int _frozenProbe(frozenTable* ft, unsigned int hash, unsigned int pilot)
+{
+  unsigned int base = _mixHash( _mixHash(hash ^ ft->seed) ^ 0x9e3779b9u );
+
+  return (int)( (base ^ _mixHash(pilot)) % (unsigned int)ft->slotCount );
+}
+
+PrintType _frozenPrint(frozenTable* ft, unsigned int hash)
+{
+  return (PrintType)( _mixHash(hash ^ ft->seed ^ 0x5bd1e995u) >> (32 - FROZEN_PRINT_BITS) );
+}
+
+unsigned long _frozenBytes(int count, int slotCount, int bucketCount)
+{
+  return sizeof(ValueType) * (unsigned long)count
+       + sizeof(unsigned int) * (unsigned long)(slotCount - count)
+       + sizeof(PrintType) * (unsigned long)FROZEN_PRINTS(count)
+       + sizeof(unsigned short) * (unsigned long)bucketCount;
+}
+
+void _frozenLayout(frozenTable* ft)
+{
+  ft->vals = (ValueType*) ft->data;
+  ft->remap = (unsigned int*)(ft->vals + ft->count);
+  ft->prints = (PrintType*)(ft->remap + (ft->slotCount - ft->count));
+  ft->pilots = (unsigned short*)(ft->prints + FROZEN_PRINTS(ft->count));
+}
+
+int _buildFrozen(frozenTable* ft, unsigned int* keyHashes, ValueType* keyVals, int n)
+{
+  int i, j, b, s;
+  int r, m, t, size, maxSize, cursor, found;
+  unsigned int p;
+  int* start;
+  int* sizes;
+  int* keys;
+  int* order;
+  int* slots;
+  int* owner;
+
+  r = n / FROZEN_LAMBDA + 1;
+
+  start = (int*) calloc(r + 1, sizeof(int));
+  sizes = (int*) calloc(r, sizeof(int));
+  keys = (int*) malloc(sizeof(int) * (n + 1));
+  order = (int*) malloc(sizeof(int) * r);
+
+  assert(start && sizes && keys && order);
+
+  ft->bucketCount = r;
+
+  /* Group keys by bucket (counting sort) */
+  for (i = 0; i < n; i++)
+    sizes[ _frozenBucket(ft, keyHashes[i]) ]++;
+
+  for (b = 0; b < r; b++)
+    start[b + 1] = start[b] + sizes[b];
+
+  for (b = 0; b < r; b++)
+    sizes[b] = 0;
+
+  for (i = 0; i < n; i++)
+  {
+    b = _frozenBucket(ft, keyHashes[i]);
+    keys[ start[b] + sizes[b]++ ] = i;
+  }
+
+  /* Equal hashes are the same key to the table, and always share a bucket: keep the first */
+  m = 0;
+  maxSize = 0;
+
+  for (b = 0; b < r; b++)
+  {
+    size = 0;
+
+    for (i = start[b]; i < start[b] + sizes[b]; i++)
+    {
+
+      for (j = start[b]; j < start[b] + size; j++)
+      {
+
+        if ( EQ(keyHashes[ keys[j] ], keyHashes[ keys[i] ]) )
+          break;
+
+      }
+
+      if (j == start[b] + size)
+        keys[ start[b] + size++ ] = keys[i];
+
+    }
+
+    sizes[b] = size;
+    m += size;
+
+    if (size > maxSize)
+      maxSize = size;
+
+  }
+
+  t = m + m / FROZEN_SLACK + 1;
+
+  ft->count = m;
+  ft->slotCount = t;
+
+  /* Order buckets largest first (counting sort on size) */
+  {
+    int* bySize = (int*) calloc(maxSize + 2, sizeof(int));
+
+    assert(bySize);
+
+    for (b = 0; b < r; b++)
+      bySize[ maxSize - sizes[b] + 1 ]++;
+
+    for (s = 1; s <= maxSize + 1; s++)
+      bySize[s] += bySize[s - 1];
+
+    for (b = 0; b < r; b++)
+      order[ bySize[ maxSize - sizes[b] ]++ ] = b;
+
+    free(bySize);
+  }
+
+  ft->data = (unsigned char*) malloc( _frozenBytes(m, t, r) );
+  owner = (int*) malloc(sizeof(int) * t);
+  slots = (int*) malloc(sizeof(int) * (maxSize + 1));
+
+  assert(ft->data && owner && slots);
+
+  _frozenLayout(ft);
+
+  for (s = 0; s < t; s++)
+    owner[s] = -1;
+
+  found = 1;
+
+  for (i = 0; (i < r) && found; i++)
+  {
+    b = order[i];
+    size = sizes[b];
+
+    ft->pilots[b] = 0;
+
+    if (size > 0)
+    {
+      found = 0;
+
+      for (p = 0; (p < FROZEN_TRIES) && !found; p++)
+      {
+
+        for (j = 0; j < size; j++)
+        {
+          slots[j] = _frozenProbe(ft, keyHashes[ keys[start[b] + j] ], p);
+
+          if (owner[ slots[j] ] != -1)
+            break;
+
+          for (s = 0; s < j; s++)
+          {
+
+            if (slots[s] == slots[j])
+              break;
+
+          }
+
+          if (s < j)
+            break;
+
+        }
+
+        if (j == size)
+        {
+          ft->pilots[b] = (unsigned short) p;
+          found = 1;
+        }
+
+      }
+
+    }
+
+    for (j = 0; (j < size) && found; j++)
+      owner[ slots[j] ] = keys[start[b] + j];
+
+  }
+
+  if (found)
+  {
+    /* Keys past 'count' are moved into the free slots below it, in order */
+    cursor = 0;
+
+    for (s = 0; s < t; s++)
+    {
+      j = s;
+
+      if (s >= m)
+      {
+        ft->remap[s - m] = 0;
+
+        if (owner[s] == -1)
+          continue;
+
+        while (owner[cursor] != -1)
+          cursor++;
+
+        ft->remap[s - m] = (unsigned int) cursor;
+        j = cursor++;
+      }
+      else if (owner[s] == -1)
+      {
+        continue;
+      }
+
+      ft->vals[j] = keyVals[ owner[s] ];
+      ft->prints[j] = _frozenPrint(ft, keyHashes[ owner[s] ]);
+    }
+
+  }
+  else
+  {
+    free(ft->data);
+    ft->data = NULL;
+  }
+
+  free(start);
+  free(sizes);
+  free(keys);
+  free(order);
+  free(owner);
+  free(slots);
+
+  return found;
+}
+
+void freezeTable(hashTable* ht, frozenTable* ft)
+{
+  int i;
+  int n;
+  unsigned int* keyHashes;
+  ValueType* keyVals;
+  hashLink* htLink;
+
+  assert(ht);
+  assert(ft);
+
+  keyHashes = (unsigned int*) malloc(sizeof(unsigned int) * (ht->count + 1));
+  keyVals = (ValueType*) malloc(sizeof(ValueType) * (ht->count + 1));
+
+  assert(keyHashes && keyVals);
+
+  n = 0;
+
+  for (i = 0; i < ht->tableSize; i++)
+  {
+
+    for (htLink = ht->table[i]; htLink; htLink = htLink->next)
+    {
+      keyHashes[n] = (unsigned int) stringHash(htLink->key);
+      keyVals[n] = htLink->val;
+
+      n++;
+    }
+
+  }
+
+  /* A pilot search only fails on an unlucky seed: re-seed and rebuild */
+  ft->seed = 0;
+
+  while ( !_buildFrozen(ft, keyHashes, keyVals, n) )
+    ft->seed = _mixHash(ft->seed + 1);
+
+  free(keyHashes);
+  free(keyVals);
+}
+
+void freeFrozen(frozenTable* ft)
+{
+  assert(ft);
+
+  free(ft->data);
+
+  ft->data = NULL;
+  ft->count = 0;
+}
+
+ValueType* findFrozen(frozenTable* ft, KeyType key)
+{
+  int slot;
+  unsigned int hash;
+
+  assert(ft);
+
+  if (ft->count == 0)
+    return NULL;
+
+  hash = (unsigned int) stringHash(key);
+  slot = _frozenProbe(ft, hash, ft->pilots[ _frozenBucket(ft, hash) ]);
+
+  if (slot >= ft->count)
+    slot = (int) ft->remap[slot - ft->count];
+
+  if ( EQ(ft->prints[slot], _frozenPrint(ft, hash)) )
+  {
+    return &ft->vals[slot];
+  }
+  else
+  {
+    return NULL;
+  }
+
+}
+
+int containsFrozen(frozenTable* ft, KeyType key)
+{
+  if ( findFrozen(ft, key) )
+  {
+    return 1;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+unsigned long sizeFrozen(frozenTable* ft)
+{
+  assert(ft);
+
+  return _frozenBytes(ft->count, ft->slotCount, ft->bucketCount);
+}
+
+int saveFrozen(frozenTable* ft, const char* fileName)
+{
+  FILE* file;
+  unsigned int header[6];
+  int ok;
+
+  assert(ft);
+
+  file = fopen(fileName, "wb");
+
+  if (!file)
+    return 0;
+
+  header[0] = FROZEN_MAGIC;
+  header[1] = (unsigned int) sizeof(PrintType);
+  header[2] = (unsigned int) ft->count;
+  header[3] = (unsigned int) ft->slotCount;
+  header[4] = (unsigned int) ft->bucketCount;
+  header[5] = ft->seed;
+
+  /* The header is followed by the data block, byte for byte */
+  ok = fwrite(header, sizeof(header), 1, file) == 1
+    && fwrite(ft->data, _frozenBytes(ft->count, ft->slotCount, ft->bucketCount), 1, file) == 1;
+
+  fclose(file);
+
+  return ok;
+}
+
+int loadFrozen(frozenTable* ft, const char* fileName)
+{
+  FILE* file;
+  unsigned int header[6];
+  unsigned long bytes;
+  long start;
+  long end;
+  int ok;
+  int i;
+
+  assert(ft);
+
+  ft->data = NULL;
+  ft->count = 0;
+
+  file = fopen(fileName, "rb");
+
+  if (!file)
+    return 0;
+
+  /* The header must describe a table freezeTable() could have built, with the matching
+   * fingerprint width, and the data block must fill the rest of the file exactly */
+  if ( fread(header, sizeof(header), 1, file) != 1 || header[0] != FROZEN_MAGIC
+       || header[1] != sizeof(PrintType)
+       || header[2] > 0x7FFFFFFFu || header[3] > 0x7FFFFFFFu || header[4] > 0x7FFFFFFFu || header[4] == 0
+       || header[3] != header[2] + header[2] / FROZEN_SLACK + 1 )
+  {
+    fclose(file);
+    return 0;
+  }
+
+  bytes = _frozenBytes((int) header[2], (int) header[3], (int) header[4]);
+
+  start = ftell(file);
+
+  if ( start < 0 || fseek(file, 0, SEEK_END) != 0 || (end = ftell(file)) < start
+       || (unsigned long)(end - start) != bytes || fseek(file, start, SEEK_SET) != 0 )
+  {
+    fclose(file);
+    return 0;
+  }
+
+  ft->data = (unsigned char*) malloc(bytes);
+
+  if (ft->data == NULL)
+  {
+    fclose(file);
+    return 0;
+  }
+
+  ft->count = (int) header[2];
+  ft->slotCount = (int) header[3];
+  ft->bucketCount = (int) header[4];
+  ft->seed = header[5];
+
+  _frozenLayout(ft);
+
+  /* One sequential read, no per-key parsing; then every remapped slot must lie below 'count' */
+  ok = fread(ft->data, bytes, 1, file) == 1;
+
+  for (i = 0; ok && (ft->count > 0) && (i < ft->slotCount - ft->count); i++)
+  {
+
+    if (ft->remap[i] >= (unsigned int) ft->count)
+      ok = 0;
+
+  }
+
+  fclose(file);
+
+  if (!ok)
+  {
+    free(ft->data);
+    ft->data = NULL;
+    ft->count = 0;
+
+    return 0;
+  }
+
+  return 1;
+}
@@ -4,11 +4,18 @@
 #define __INTERFACES_H
 
 /* HASHTABLE */
+int stringHash(char* str);
+void stringHashMany(KeyType* keys, int* hashes, int n);
+void _stringHashLanesScalar(KeyType* keys, int* hashes);
 void initTable(hashTable* ht, int tableSize);
 void freeTable(hashTable* ht);
 void freeTableBody(hashLink** htb, int oldSize);
 void insertTable(hashTable* ht, KeyType key, ValueType val);
+void _insertHashed(hashTable* ht, KeyType key, ValueType val, int keyHash);
+void insertManyTable(hashTable* ht, KeyType* keys, ValueType* vals, int n);
 void removeKey(hashTable* ht, KeyType key);
+int removeIfTable(hashTable* ht, int (*pred)(KeyType, ValueType, void*), void* ctx);
+void shrinkTable(hashTable* ht);
 void printTable(hashTable* ht);
 int containsKey(hashTable* ht, KeyType key);
 int isEmptyTable(hashTable* ht);
@@ -16,7 +23,27 @@ int sizeTable(hashTable* ht);
 int emptyBuckets(hashTable* ht);
 float tableLoad(hashTable* ht);
 struct hashLink* findLink(hashTable* ht, KeyType key);
+void containsManyKeys(hashTable* ht, KeyType* keys, int* out, int n);
+struct hashLink* _findHashed(hashTable* ht, int paramKeyHash);
 void _resizeTable(hashTable* ht);
 /* END HASHTABLE */
 
+/* FROZEN TABLE */
+void freezeTable(hashTable* ht, frozenTable* ft);
+void freeFrozen(frozenTable* ft);
+/* Approximate for absent keys: they are found 1 time in 2^FROZEN_PRINT_BITS (see structs.h) */
+ValueType* findFrozen(frozenTable* ft, KeyType key);
+int containsFrozen(frozenTable* ft, KeyType key);
+unsigned long sizeFrozen(frozenTable* ft);
+int saveFrozen(frozenTable* ft, const char* fileName);
+int loadFrozen(frozenTable* ft, const char* fileName);
+unsigned int _mixHash(unsigned int h);
+int _frozenBucket(frozenTable* ft, unsigned int hash);
+int _frozenProbe(frozenTable* ft, unsigned int hash, unsigned int pilot);
+PrintType _frozenPrint(frozenTable* ft, unsigned int hash);
+unsigned long _frozenBytes(int count, int slotCount, int bucketCount);
+void _frozenLayout(frozenTable* ft);
+int _buildFrozen(frozenTable* ft, unsigned int* keyHashes, ValueType* keyVals, int n);
+/* END FROZEN TABLE */
+
 #endif
\ No newline at end of file
@@ -6,17 +6,20 @@
 
 
 char* getWord(FILE *file); /* getWord function referenced from Professor Sinisa Todorovic */
+int isRare(KeyType key, ValueType val, void* ctx);
 
 /*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
 
 int main(int argc, char const *argv[])
 {
   hashTable ht;
+  frozenTable ft;
   hashLink* htLink;
   FILE* file;
 
   const char* fileName;
   char* word;
+  int minCount = 2;
 
   if (argc == 2)
   {
@@ -98,6 +101,10 @@ int main(int argc, char const *argv[])
 
   printf("- Contains key {\"the\"}?: %d\n\n", containsKey(&ht, "the"));
 
+  printf("- Removing keys seen less than %d times: %d removed\n\n", minCount, removeIfTable(&ht, isRare, &minCount));
+
+  shrinkTable(&ht);
+
   printf("- Book-kept element count:  %d\n", ht.count);
   printf("- Calculated element count: %d\n\n", sizeTable(&ht));
 
@@ -106,6 +113,22 @@ int main(int argc, char const *argv[])
 
   printf("\n");
 
+  printf("- Freezing table...\n\n");
+
+  freezeTable(&ht, &ft);
+
+  printf("- Frozen contains key {\"night\"}?: %d\n", containsFrozen(&ft, "night"));
+  printf("- Frozen contains key {\"the\"}?:   %d\n\n", containsFrozen(&ft, "the"));
+
+  printf("- Frozen keys:  %d\n", ft.count);
+  printf("- Frozen bytes: %lu\n", sizeFrozen(&ft));
+
+  printf("\n");
+
+  printf("- Freeing Frozen table memory.\n");
+
+  freeFrozen(&ft);
+
   printf("- Freeing Hashtable memory.\n");  
 
   freeTable(&ht);
@@ -163,3 +186,12 @@ char* getWord(FILE *file)
   word[length] = '\0';
   return word;
 }
+
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+int isRare(KeyType key, ValueType val, void* ctx)
+{
+  (void) key;
+
+  return val < *(int*)ctx;
+}
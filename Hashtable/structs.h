@@ -14,6 +14,9 @@
   # define KeyType char*
   # define ValueType int
 
+  # define HASH_LANES 8   /* Keys hashed side by side by stringHashMany */
+  # define HASH_BATCH 64  /* Keys hashed ahead by the batched insert & lookup */
+
   typedef struct hashLink
   {
     struct hashLink* next;
@@ -32,6 +35,56 @@
 
   #endif
 
+  # ifndef FROZENTABLE
+  # define FROZENTABLE
+
+  # define FROZEN_LAMBDA 4            /* Average keys per pilot bucket */
+  # define FROZEN_SLACK  32           /* One spare slot per FROZEN_SLACK keys */
+  # define FROZEN_TRIES  65536        /* Pilot search limit before re-seeding (pilots are 16-bit) */
+  # define FROZEN_MAGIC  0x46525a33u  /* "FRZ3" */
+
+  /* Fingerprint width: an absent key is found 1 time in 2^FROZEN_PRINT_BITS.
+   * Build with -DFROZEN_PRINT_BITS=16 or 32 for fewer false hits, at that many bits per key. */
+  # ifndef FROZEN_PRINT_BITS
+  # define FROZEN_PRINT_BITS 8
+  # endif
+
+  # if FROZEN_PRINT_BITS == 8
+  typedef unsigned char PrintType;
+  # elif FROZEN_PRINT_BITS == 16
+  typedef unsigned short PrintType;
+  # elif FROZEN_PRINT_BITS == 32
+  typedef unsigned int PrintType;
+  # else
+  # error "FROZEN_PRINT_BITS must be 8, 16 or 32"
+  # endif
+
+  /* Fingerprints are rounded up to an even count, so the 16-bit pilots after them stay aligned */
+  # define FROZEN_PRINTS(count) ( (count) + ((count) & 1) )
+
+  /* Immutable minimal perfect hash table.
+   * 'data' is a single flat block, laid out as:
+   *   [ vals: count ] [ remap: slotCount - count ] [ prints: FROZEN_PRINTS(count) ] [ pilots: bucketCount ]
+   * Pilots are 16-bit and each slot keeps a fingerprint of its key's hash, so the index
+   * costs about 4 + FROZEN_PRINT_BITS + 1 bits per key on top of the values.
+   * It holds no pointers, so it can be written out and read (or mapped) back as-is. */
+  typedef struct frozenTable
+  {
+    unsigned char* data;
+
+    ValueType*      vals;
+    unsigned int*   remap;
+    unsigned short* pilots;
+    PrintType*      prints;
+
+    int count;
+    int slotCount;
+    int bucketCount;
+    unsigned int seed;
+  } frozenTable;
+
+  #endif
+
   # ifndef BASIC_STRUCTS
   # define BASIC_STRUCTS
 
@@ -0,0 +1,921 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+/* --------------------------------------------
+ *
+ *              ADAPTIVE RADIX TREE
+ *
+ * Foundation used:   Node (radix, 4/16/48/256-way)
+ *
+ * A key is walked one byte at a time, most significant first, so the
+ * depth is bounded by the key width instead of the insertion order, and
+ * each level is an array lookup rather than a comparison. Inner nodes
+ * grow and shrink between four layouts to fit their child count, leaves
+ * are packed into the child pointers, and runs of bytes shared by a
+ * whole subtree are stored once, as a prefix. The in-order walk follows
+ * the byte order, which is the numeric order of the keys.
+ *
+ * --------------------------------------------
+ */
+
+# define IS_LEAF(link)  ( ((unsigned long) (link)) & 1UL )
+# define LEAF(key)      ( (struct ARTNode*) ((((unsigned long) (key)) << 1) | 1UL) )
+# define LEAF_KEY(link) ( (unsigned int) (((unsigned long) (link)) >> 1) )
+
+# define BYTE(key, depth) ( (unsigned char) ((key) >> (8 * (ART_KEY_BYTES - 1 - (depth)))) )
+# define SIGN_BIT         ( 1U << (8 * ART_KEY_BYTES - 1) )
+
+void initART(struct ART* tree)
+{
+  /*  Description:
+   *    Function initializes a radix tree structure using a pointer to its memory address.
+   *    The function does not allocate additional memory upon initialization.
+   *
+   *  Parameters:
+   *    [struct] (ART*) tree: A pointer to the radix tree.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *
+   *  Post-conditions:
+   *    - The radix tree is initialized: the size is 0, and the root points to NULL.
+   */
+
+  assert(tree);
+  assert( sizeof(unsigned long) > ART_KEY_BYTES );
+
+  tree->root = NULL;
+  tree->size = 0;
+}
+
+void freeART(struct ART* tree)
+{
+  /*  Description:
+   *    Complexity O(n).
+   *    Function frees every inner node; leaves hold no memory.
+   *
+   *  Parameters:
+   *    [struct] (ART*) tree: A pointer to the radix tree.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized radix tree.
+   *
+   *  Post-conditions:
+   *    - All nodes are freed, and the radix tree is empty.
+   */
+
+  assert(tree);
+
+  if (tree->root)
+    _freeNode(tree->root);
+
+  initART(tree);
+}
+
+int containsART(struct ART* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(k), for k key bytes.
+   *    Function follows the key's bytes down to a leaf. Prefixes are skipped over rather than
+   *    checked: a mismatch can only lead to a missing child or to a leaf with another key,
+   *    and the leaf holds the whole key, so the one comparison at the end decides.
+   *
+   *  Parameters:
+   *    [struct] (ART*) tree: A pointer to the radix tree.
+   *    [TYPE]          val : The value to search for.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value is contained, False otherwise.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized radix tree.
+   *
+   *  Post-conditions:
+   *    - True (1) or False (0) is returned, accordingly.
+   */
+
+  struct ARTNode** link;
+  struct ARTNode* node;
+  unsigned int key = _keyOf(val);
+  int depth = 0;
+
+  assert(tree);
+
+  node = tree->root;
+
+  while ( node && !IS_LEAF(node) )
+  {
+    depth += node->prefixLength;
+
+    link = _findChild(node, BYTE(key, depth));
+
+    if (link == NULL)
+      return 0;
+
+    node = *link;
+    depth++;
+  }
+
+  if ( node && (LEAF_KEY(node) == key) )
+    return 1;
+  else
+    return 0;
+
+}
+
+int addART(struct ART* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(k), for k key bytes.
+   *    Function adds the value, if not already contained. Walking down, the key meets one of:
+   *
+   *    - A free byte in an inner node -> the leaf is added there, growing the node if full.
+   *    - A leaf with another key      -> a Node4 replaces it, holding both leaves, with the
+   *                                      bytes the two keys share as its prefix.
+   *    - A prefix it differs from     -> a Node4 is put above the inner node, holding the
+   *                                      shared part of the prefix; the node keeps the rest.
+   *
+   *  Parameters:
+   *    [struct] (ART*) tree: A pointer to the radix tree.
+   *    [TYPE]          val : The value to add.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was added, False if it was already contained.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized radix tree.
+   *
+   *  Post-conditions:
+   *    - The value is contained.
+   */
+
+  struct ARTNode** link;
+  struct ARTNode** child;
+  struct ARTNode* node;
+  struct ARTNode* split;
+  unsigned int key = _keyOf(val);
+  unsigned int other;
+  int matched;
+  int depth = 0;
+
+  assert(tree);
+
+  link = &tree->root;
+
+  while (1)
+  {
+    node = *link;
+
+    if (node == NULL)
+    {
+      *link = LEAF(key);
+
+      break;
+    }
+
+    if ( IS_LEAF(node) )
+    {
+      other = LEAF_KEY(node);
+
+      if (other == key)
+        return 0;
+
+      split = _newInner(ART_NODE4);
+
+      while ( BYTE(other, depth) == BYTE(key, depth) )
+      {
+        split->prefix[split->prefixLength++] = BYTE(key, depth);
+
+        depth++;
+      }
+
+      _insertChild(split, BYTE(other, depth), node);
+      _insertChild(split, BYTE(key, depth), LEAF(key));
+
+      *link = split;
+
+      break;
+    }
+
+    matched = _matchPrefix(node, key, depth);
+
+    if (matched < node->prefixLength)
+    {
+      split = _newInner(ART_NODE4);
+
+      split->prefixLength = (unsigned char) matched;
+      memcpy(split->prefix, node->prefix, matched);
+
+      _insertChild(split, node->prefix[matched], node);
+      _insertChild(split, BYTE(key, depth + matched), LEAF(key));
+
+      /* The node keeps what follows the byte it now hangs from */
+      node->prefixLength -= matched + 1;
+      memmove(node->prefix, node->prefix + matched + 1, node->prefixLength);
+
+      *link = split;
+
+      break;
+    }
+
+    depth += node->prefixLength;
+
+    child = _findChild(node, BYTE(key, depth));
+
+    if (child == NULL)
+    {
+      _addChild(link, BYTE(key, depth), LEAF(key));
+
+      break;
+    }
+
+    link = child;
+    depth++;
+  }
+
+  tree->size++;
+
+  return 1;
+}
+
+int removeART(struct ART* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(k), for k key bytes.
+   *    Function removes the value, if contained. The leaf is taken out of its parent, which
+   *    shrinks to a smaller layout once it is sparse enough; a Node4 left with a single child
+   *    is replaced by that child, its prefix and byte joining the child's prefix.
+   *
+   *  Parameters:
+   *    [struct] (ART*) tree: A pointer to the radix tree.
+   *    [TYPE]          val : The value to remove.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was removed, False if it was not contained.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized radix tree.
+   *
+   *  Post-conditions:
+   *    - The value is not contained.
+   */
+
+  struct ARTNode** link;
+  struct ARTNode** child;
+  struct ARTNode* node;
+  unsigned int key = _keyOf(val);
+  unsigned char byte;
+  int depth = 0;
+
+  assert(tree);
+
+  node = tree->root;
+
+  if (node == NULL)
+    return 0;
+
+  if ( IS_LEAF(node) )
+  {
+
+    if (LEAF_KEY(node) != key)
+      return 0;
+
+    tree->root = NULL;
+    tree->size--;
+
+    return 1;
+  }
+
+  link = &tree->root;
+
+  while (1)
+  {
+    node = *link;
+
+    if (_matchPrefix(node, key, depth) < node->prefixLength)
+      return 0;
+
+    depth += node->prefixLength;
+    byte = BYTE(key, depth);
+
+    child = _findChild(node, byte);
+
+    if (child == NULL)
+      return 0;
+
+    if ( IS_LEAF(*child) )
+    {
+
+      if (LEAF_KEY(*child) != key)
+        return 0;
+
+      _removeChild(link, byte);
+
+      break;
+    }
+
+    link = child;
+    depth++;
+  }
+
+  tree->size--;
+
+  return 1;
+}
+
+void printART(struct ART* tree)
+{
+  /*  Description:
+   *    Function prints the values in-order.
+   *
+   *  Parameters:
+   *    [struct] (ART*) tree: A pointer to the radix tree.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized radix tree.
+   *
+   *  Post-conditions:
+   *    - The values are printed to stdout in-order.
+   */
+
+  forEachART(tree, _printVal, NULL);
+}
+
+int isEmptyART(struct ART* tree)
+{
+  /*  Description:
+   *    Function returns whether the radix tree is empty.
+   *
+   *  Parameters:
+   *    [struct] (ART*) tree: A pointer to the radix tree.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the radix tree is empty, False otherwise.
+   */
+
+  assert(tree);
+
+  if (tree->size == 0)
+    return 1;
+  else
+    return 0;
+
+}
+
+void forEachART(struct ART* tree, void (*visit)(TYPE val, void* ctx), void* ctx)
+{
+  /*  Description:
+   *    Complexity O(n).
+   *    Function calls 'visit' on every value, in-order.
+   *
+   *  Parameters:
+   *    [struct] (ART*)             tree : A pointer to the radix tree.
+   *    [void]   (*)(TYPE, void*)   visit: The function to call, given each value and 'ctx'.
+   *    [void]   (void*)            ctx  : Passed through to 'visit'.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized radix tree.
+   *    - 'visit' does not change the radix tree.
+   */
+
+  assert(tree);
+  assert(visit);
+
+  if (tree->root)
+    _walkNode(tree->root, visit, ctx);
+
+}
+
+unsigned long bytesART(struct ART* tree)
+{
+  /*  Description:
+   *    Complexity O(n).
+   *    Function returns the memory held by the radix tree's inner nodes, in bytes.
+   *
+   *  Parameters:
+   *    [struct] (ART*) tree: A pointer to the radix tree.
+   *
+   *  Returns:
+   *    [unsigned long] (bytes): The bytes allocated for the nodes; leaves take none.
+   */
+
+  assert(tree);
+
+  if (tree->root)
+    return _bytesNode(tree->root);
+  else
+    return 0;
+
+}
+
+unsigned int _keyOf(TYPE val)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns the key of a value: flipping the sign bit puts negative values first,
+   *    so the unsigned order of keys is the signed order of values.
+   */
+
+  return ((unsigned int) val) ^ SIGN_BIT;
+}
+
+TYPE _valOf(unsigned int key)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns the value of a key. Inverse of " _keyOf() ".
+   */
+
+  return (TYPE) (key ^ SIGN_BIT);
+}
+
+int _matchPrefix(struct ARTNode* node, unsigned int key, int depth)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns how many bytes of the node's prefix match the key, from the given depth.
+   */
+
+  int i;
+
+  for (i = 0; i < node->prefixLength; i++)
+  {
+
+    if ( node->prefix[i] != BYTE(key, depth + i) )
+      break;
+
+  }
+
+  return i;
+}
+
+struct ARTNode* _newInner(int type)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Allocates an empty inner node of the given kind, with no prefix.
+   */
+
+  struct ARTNode* node = calloc( 1, _sizeOfType(type) );
+  assert(node);
+
+  node->type = (short) type;
+
+  return node;
+}
+
+unsigned long _sizeOfType(int type)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns the size in bytes of an inner node of the given kind.
+   */
+
+  switch (type)
+  {
+    case ART_NODE4:  return sizeof(struct ARTNode4);
+    case ART_NODE16: return sizeof(struct ARTNode16);
+    case ART_NODE48: return sizeof(struct ARTNode48);
+    default:         return sizeof(struct ARTNode256);
+  }
+
+}
+
+struct ARTNode** _findChild(struct ARTNode* node, unsigned char byte)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns a pointer to the node's child link for the byte, or NULL if it has none.
+   *    Node4 and Node16 scan their sorted bytes; Node48 and Node256 index directly.
+   */
+
+  struct ARTNode4* node4;
+  struct ARTNode16* node16;
+  struct ARTNode48* node48;
+  struct ARTNode256* node256;
+  int i;
+
+  switch (node->type)
+  {
+    case ART_NODE4:
+      node4 = (struct ARTNode4*) node;
+
+      for (i = 0; i < node->count; i++)
+      {
+
+        if (node4->keys[i] == byte)
+          return &node4->children[i];
+
+      }
+
+      return NULL;
+
+    case ART_NODE16:
+      node16 = (struct ARTNode16*) node;
+
+      for (i = 0; (i < node->count) && (node16->keys[i] <= byte); i++)
+      {
+
+        if (node16->keys[i] == byte)
+          return &node16->children[i];
+
+      }
+
+      return NULL;
+
+    case ART_NODE48:
+      node48 = (struct ARTNode48*) node;
+
+      if (node48->index[byte])
+        return &node48->children[node48->index[byte] - 1];
+
+      return NULL;
+
+    default:
+      node256 = (struct ARTNode256*) node;
+
+      if (node256->children[byte])
+        return &node256->children[byte];
+
+      return NULL;
+  }
+
+}
+
+void _insertChild(struct ARTNode* node, unsigned char byte, struct ARTNode* child)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Adds the child under a byte the node has no child for, keeping Node4 and Node16
+   *    bytes sorted. The node must have room.
+   */
+
+  unsigned char* keys;
+  struct ARTNode** children;
+  struct ARTNode48* node48;
+  int i;
+
+  assert(node->count < node->type);
+
+  switch (node->type)
+  {
+    case ART_NODE4:
+    case ART_NODE16:
+
+      if (node->type == ART_NODE4)
+      {
+        keys = ((struct ARTNode4*) node)->keys;
+        children = ((struct ARTNode4*) node)->children;
+      }
+      else
+      {
+        keys = ((struct ARTNode16*) node)->keys;
+        children = ((struct ARTNode16*) node)->children;
+      }
+
+      for (i = node->count; (i > 0) && (keys[i - 1] > byte); i--)
+      {
+        keys[i] = keys[i - 1];
+        children[i] = children[i - 1];
+      }
+
+      keys[i] = byte;
+      children[i] = child;
+
+      break;
+
+    case ART_NODE48:
+      node48 = (struct ARTNode48*) node;
+
+      /* Removals can leave holes, so take the first free slot */
+      for (i = 0; node48->children[i]; i++)
+        ;
+
+      node48->children[i] = child;
+      node48->index[byte] = (unsigned char) (i + 1);
+
+      break;
+
+    default:
+      ((struct ARTNode256*) node)->children[byte] = child;
+
+      break;
+  }
+
+  node->count++;
+}
+
+void _deleteChild(struct ARTNode* node, unsigned char byte)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Takes the byte's child out of the node, which must have one.
+   */
+
+  unsigned char* keys;
+  struct ARTNode** children;
+  struct ARTNode48* node48;
+  int i;
+
+  switch (node->type)
+  {
+    case ART_NODE4:
+    case ART_NODE16:
+
+      if (node->type == ART_NODE4)
+      {
+        keys = ((struct ARTNode4*) node)->keys;
+        children = ((struct ARTNode4*) node)->children;
+      }
+      else
+      {
+        keys = ((struct ARTNode16*) node)->keys;
+        children = ((struct ARTNode16*) node)->children;
+      }
+
+      for (i = 0; keys[i] != byte; i++)
+        ;
+
+      for (; i < node->count - 1; i++)
+      {
+        keys[i] = keys[i + 1];
+        children[i] = children[i + 1];
+      }
+
+      break;
+
+    case ART_NODE48:
+      node48 = (struct ARTNode48*) node;
+
+      node48->children[node48->index[byte] - 1] = NULL;
+      node48->index[byte] = 0;
+
+      break;
+
+    default:
+      ((struct ARTNode256*) node)->children[byte] = NULL;
+
+      break;
+  }
+
+  node->count--;
+}
+
+void _addChild(struct ARTNode** link, unsigned char byte, struct ARTNode* child)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Adds the child to the linked node, first moving a full node to the next larger layout.
+   */
+
+  if ( (*link)->count == (*link)->type )
+    *link = _resizeNode(*link, (*link)->type == ART_NODE4 ? ART_NODE16 :
+                               (*link)->type == ART_NODE16 ? ART_NODE48 : ART_NODE256);
+
+  _insertChild(*link, byte, child);
+}
+
+void _removeChild(struct ARTNode** link, unsigned char byte)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Removes the byte's child from the linked node, then moves a sparse node to the next
+   *    smaller layout. Each layout shrinks well below the count it grew at, so a value added
+   *    and removed over and over cannot resize the node every time. A Node4 left with one
+   *    child is replaced by it.
+   */
+
+  struct ARTNode* node;
+
+  _deleteChild(*link, byte);
+
+  node = *link;
+
+  if ( (node->type == ART_NODE4) && (node->count == 1) )
+    _collapseNode(link);
+  else if ( (node->type == ART_NODE16) && (node->count <= 3) )
+    *link = _resizeNode(node, ART_NODE4);
+  else if ( (node->type == ART_NODE48) && (node->count <= 12) )
+    *link = _resizeNode(node, ART_NODE16);
+  else if ( (node->type == ART_NODE256) && (node->count <= 40) )
+    *link = _resizeNode(node, ART_NODE48);
+
+}
+
+struct ARTNode* _resizeNode(struct ARTNode* node, int type)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Moves the node's prefix and children into a new node of the given kind, which must
+   *    have room for them, and frees the old node.
+   */
+
+  unsigned char bytes[256];
+  struct ARTNode* children[256];
+  struct ARTNode* resized;
+  int n;
+  int i;
+
+  resized = _newInner(type);
+
+  resized->prefixLength = node->prefixLength;
+  memcpy(resized->prefix, node->prefix, node->prefixLength);
+
+  n = _listChildren(node, bytes, children);
+
+  for (i = 0; i < n; i++)
+    _insertChild(resized, bytes[i], children[i]);
+
+  free(node);
+
+  return resized;
+}
+
+void _collapseNode(struct ARTNode** link)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Replaces a Node4 holding one child by that child. A leaf holds its whole key and moves
+   *    up as is; an inner node takes the Node4's prefix and byte in front of its own prefix.
+   */
+
+  struct ARTNode4* node = (struct ARTNode4*) *link;
+  struct ARTNode* child = node->children[0];
+  unsigned char prefix[ART_KEY_BYTES];
+  int length;
+
+  if ( !IS_LEAF(child) )
+  {
+    length = node->header.prefixLength;
+
+    memcpy(prefix, node->header.prefix, length);
+    prefix[length++] = node->keys[0];
+    memcpy(prefix + length, child->prefix, child->prefixLength);
+
+    child->prefixLength += length;
+    memcpy(child->prefix, prefix, child->prefixLength);
+  }
+
+  *link = child;
+
+  free(node);
+}
+
+int _listChildren(struct ARTNode* node, unsigned char* bytes, struct ARTNode** children)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Fills the arrays with the node's bytes and children, in byte order, and returns
+   *    how many there are.
+   */
+
+  struct ARTNode4* node4;
+  struct ARTNode16* node16;
+  struct ARTNode48* node48;
+  struct ARTNode256* node256;
+  int n = 0;
+  int i;
+
+  switch (node->type)
+  {
+    case ART_NODE4:
+      node4 = (struct ARTNode4*) node;
+
+      memcpy(bytes, node4->keys, node->count);
+      memcpy(children, node4->children, node->count * sizeof(struct ARTNode*));
+
+      return node->count;
+
+    case ART_NODE16:
+      node16 = (struct ARTNode16*) node;
+
+      memcpy(bytes, node16->keys, node->count);
+      memcpy(children, node16->children, node->count * sizeof(struct ARTNode*));
+
+      return node->count;
+
+    case ART_NODE48:
+      node48 = (struct ARTNode48*) node;
+
+      for (i = 0; i < 256; i++)
+      {
+
+        if (node48->index[i])
+        {
+          bytes[n] = (unsigned char) i;
+          children[n++] = node48->children[node48->index[i] - 1];
+        }
+
+      }
+
+      return n;
+
+    default:
+      node256 = (struct ARTNode256*) node;
+
+      for (i = 0; i < 256; i++)
+      {
+
+        if (node256->children[i])
+        {
+          bytes[n] = (unsigned char) i;
+          children[n++] = node256->children[i];
+        }
+
+      }
+
+      return n;
+  }
+
+}
+
+void _freeNode(struct ARTNode* node)
+{
+  /*  Description:
+   *    Recursive auxiliary function.
+   *    Frees the inner nodes of the subtree; the recursion is no deeper than the key width.
+   */
+
+  unsigned char bytes[256];
+  struct ARTNode* children[256];
+  int n;
+  int i;
+
+  if ( IS_LEAF(node) )
+    return;
+
+  n = _listChildren(node, bytes, children);
+
+  for (i = 0; i < n; i++)
+    _freeNode(children[i]);
+
+  free(node);
+}
+
+void _walkNode(struct ARTNode* node, void (*visit)(TYPE val, void* ctx), void* ctx)
+{
+  /*  Description:
+   *    Recursive auxiliary function.
+   *    Visits the subtree's values in byte order; the recursion is no deeper than the key width.
+   */
+
+  unsigned char bytes[256];
+  struct ARTNode* children[256];
+  int n;
+  int i;
+
+  if ( IS_LEAF(node) )
+  {
+    visit(_valOf(LEAF_KEY(node)), ctx);
+
+    return;
+  }
+
+  n = _listChildren(node, bytes, children);
+
+  for (i = 0; i < n; i++)
+    _walkNode(children[i], visit, ctx);
+
+}
+
+unsigned long _bytesNode(struct ARTNode* node)
+{
+  /*  Description:
+   *    Recursive auxiliary function.
+   *    Returns the bytes held by the subtree's inner nodes.
+   */
+
+  unsigned char bytes[256];
+  struct ARTNode* children[256];
+  unsigned long total;
+  int n;
+  int i;
+
+  if ( IS_LEAF(node) )
+    return 0;
+
+  total = _sizeOfType(node->type);
+
+  n = _listChildren(node, bytes, children);
+
+  for (i = 0; i < n; i++)
+    total += _bytesNode(children[i]);
+
+  return total;
+}
+
+void _printVal(TYPE val, void* ctx)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Prints one value, as " printART() " visits it.
+   */
+
+  (void) ctx;
+
+  printf("Node with value: { %d }\n", val);
+}
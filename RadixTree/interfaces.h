@@ -0,0 +1,35 @@
+#include "structs.h"
+
+#ifndef __INTERFACES_H
+#define __INTERFACES_H
+
+/* Adaptive Radix Tree */
+void initART(struct ART* tree);
+void freeART(struct ART* tree);
+int containsART(struct ART* tree, TYPE val);
+int addART(struct ART* tree, TYPE val);
+int removeART(struct ART* tree, TYPE val);
+void printART(struct ART* tree);
+int isEmptyART(struct ART* tree);
+void forEachART(struct ART* tree, void (*visit)(TYPE val, void* ctx), void* ctx);
+unsigned long bytesART(struct ART* tree);
+unsigned int _keyOf(TYPE val);
+TYPE _valOf(unsigned int key);
+int _matchPrefix(struct ARTNode* node, unsigned int key, int depth);
+struct ARTNode* _newInner(int type);
+unsigned long _sizeOfType(int type);
+struct ARTNode** _findChild(struct ARTNode* node, unsigned char byte);
+void _insertChild(struct ARTNode* node, unsigned char byte, struct ARTNode* child);
+void _deleteChild(struct ARTNode* node, unsigned char byte);
+void _addChild(struct ARTNode** link, unsigned char byte, struct ARTNode* child);
+void _removeChild(struct ARTNode** link, unsigned char byte);
+struct ARTNode* _resizeNode(struct ARTNode* node, int type);
+void _collapseNode(struct ARTNode** link);
+int _listChildren(struct ARTNode* node, unsigned char* bytes, struct ARTNode** children);
+void _freeNode(struct ARTNode* node);
+void _walkNode(struct ARTNode* node, void (*visit)(TYPE val, void* ctx), void* ctx);
+unsigned long _bytesNode(struct ARTNode* node);
+void _printVal(TYPE val, void* ctx);
+/* END Adaptive Radix Tree */
+
+#endif
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "structs.h"
+#include "interfaces.h"
+
+
+int main(int argc, char const *argv[])
+{
+  struct ART tree;
+  FILE* file;
+  const char* fileName;
+  int quantity;
+  int val;
+
+  if (argc == 2)
+  {
+    fileName = argv[1];
+  }
+  else
+  {
+    fileName = "input.txt";
+  } 
+
+  file = fopen(fileName,"r");
+
+  printf("\n--------------------------------------------\n");
+
+  printf("\nHello! I'm here to generate simple visualizations of some basic data structures:\n");
+  printf("- Adaptive Radix Tree\n\n");
+
+  printf("Press ENTER to continue.\n\n");
+  getchar();
+
+  /* --------------------------------------------
+   *
+   *            ADAPTIVE RADIX TREE
+   * 
+   * --------------------------------------------
+   */
+
+  quantity = 25;
+
+  printf("Here are some Adaptive Radix Tree operations:\n\n");
+
+  initART(&tree);
+
+  printf("- isEmpty: %d\n\n", isEmptyART(&tree));
+
+  printf("- Adding values from %s...\n\n", fileName);
+
+  while ( !feof(file) && (quantity > 0) )
+  {
+    fscanf(file, "%d", &val);
+
+    addART(&tree, val);
+
+    quantity--;
+  }
+
+  printf("- isEmpty: %d\n\n", isEmptyART(&tree));
+
+  printf("- contains {747}?: %d\n\n", containsART(&tree, 747));
+  printf("- contains {199}?: %d\n\n", containsART(&tree, 199));
+
+  printf("- contains {-5}?: %d\n\n", containsART(&tree, -5));
+
+  printf("- Ready to print. Press ENTER.\n");
+  getchar();
+
+  printART(&tree);
+
+  printf("\n- add {-5}: %d\n", addART(&tree, -5));
+  printf("- add {-5}: %d\n", addART(&tree, -5));
+  printf("- contains {-5}?: %d\n", containsART(&tree, -5));
+
+  printf("\n- size: %d, node bytes: %lu\n", tree.size, bytesART(&tree));
+
+  printf("\n- removing {747}: %d\n", removeART(&tree, 747));
+  printf("- removing {747}: %d\n\n", removeART(&tree, 747));
+
+  printf("- contains {747}?: %d\n", containsART(&tree, 747));
+
+  printf("\n");
+
+  printf("- Freeing Adaptive Radix Tree memory.\n");
+
+  freeART(&tree);
+
+  /* --------------------------------------------
+   *
+   *          END ADAPTIVE RADIX TREE
+   * 
+   * --------------------------------------------
+   */
+
+  printf("\n--------------------------------------------\n");
+
+  fclose(file);
+  
+  return 0;
+}
@@ -0,0 +1,70 @@
+#ifndef __STRUCTS_H
+#define __STRUCTS_H
+
+/* Keys are ints, read as big-endian bytes with the sign bit flipped, so that the byte
+ * order of the keys is their numeric order. There is no EQ / LT: nothing is compared. */
+# define TYPE      int
+# define TYPE_SIZE sizeof(int)
+
+# define ART_KEY_BYTES sizeof(int)  /* Bytes per key: also the greatest depth, in inner nodes */
+
+# define ART_NODE4   4              /* Node kinds, named for their capacity */
+# define ART_NODE16  16
+# define ART_NODE48  48
+# define ART_NODE256 256
+
+struct ART
+{
+  struct ARTNode* root;
+  int size;
+};
+
+/* A child pointer is either an inner node, or a leaf: the key itself, shifted left
+ * with the low bit set, so leaves take no memory of their own (unsigned long must
+ * be wider than the key). A leaf sits as high as its key is unique (lazy expansion);
+ * bytes shared by every key below an inner node are kept as its prefix (path
+ * compression). */
+struct ARTNode
+{
+  short type;
+  short count;
+
+  unsigned char prefixLength;
+  unsigned char prefix[ART_KEY_BYTES];
+};
+
+/* Up to 4 / 16 children: key bytes kept sorted, children at the same positions */
+struct ARTNode4
+{
+  struct ARTNode header;
+
+  unsigned char keys[4];
+  struct ARTNode* children[4];
+};
+
+struct ARTNode16
+{
+  struct ARTNode header;
+
+  unsigned char keys[16];
+  struct ARTNode* children[16];
+};
+
+/* Up to 48 children: index[byte] is the child's slot + 1, or 0 for none */
+struct ARTNode48
+{
+  struct ARTNode header;
+
+  unsigned char index[256];
+  struct ARTNode* children[48];
+};
+
+/* Up to 256 children, indexed by the byte directly */
+struct ARTNode256
+{
+  struct ARTNode header;
+
+  struct ARTNode* children[256];
+};
+
+#endif
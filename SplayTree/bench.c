@@ -0,0 +1,157 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "structs.h"
+#include "interfaces.h"
+
+# define BENCH_KEYS    (1 << 20)
+# define BENCH_QUERIES (1 << 22)
+
+
+unsigned int nextRandom(unsigned int* state); /* xorshift32 */
+void zipfQueries(int* keys, int* queries, double s, unsigned int* state);
+double timeLookups(int* keys, int* queries, int period, int* found);
+
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+int main(void)
+{
+  /* Lookups of Zipf-distributed keys: a perfectly balanced tree that is never splayed
+   * (the plain tree's best case) against splaying on every k-th lookup. */
+
+  double skews[4] = { 0.0, 1.0, 1.5, 2.0 };
+  int periods[4] = { 0, 1, 4, 16 };
+  unsigned int state = 12345;
+  int* keys;
+  int* queries;
+  int found;
+  int i;
+  int j;
+
+  keys = (int*) malloc(sizeof(int) * BENCH_KEYS);
+  queries = (int*) malloc(sizeof(int) * BENCH_QUERIES);
+
+  if (!keys || !queries)
+    return 1;
+
+  for (i = 0; i < BENCH_KEYS; i++)
+    keys[i] = 2 * i;
+
+  printf("%d keys, %d lookups; seconds per run (hits)\n\n", BENCH_KEYS, BENCH_QUERIES);
+  printf("zipf s   balanced   splay k=1  splay k=4  splay k=16\n");
+
+  for (i = 0; i < 4; i++)
+  {
+    zipfQueries(keys, queries, skews[i], &state);
+
+    printf("%6.1f", skews[i]);
+
+    for (j = 0; j < 4; j++)
+      printf("   %8.3f", timeLookups(keys, queries, periods[j], &found));
+
+    printf("   (%d)\n", found);
+  }
+
+  free(keys);
+  free(queries);
+
+  return 0;
+}
+
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+unsigned int nextRandom(unsigned int* state)
+{
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+
+  return *state;
+}
+
+void zipfQueries(int* keys, int* queries, double s, unsigned int* state)
+{
+  /* The key of popularity rank r is drawn with probability proportional to 1 / r^s.
+   * Ranks are given to keys in random order, so hot keys are spread over the tree. */
+
+  double* cdf = (double*) malloc(sizeof(double) * BENCH_KEYS);
+  int* ranked = (int*) malloc(sizeof(int) * BENCH_KEYS);
+  double total = 0;
+  double u;
+  int lo;
+  int hi;
+  int mid;
+  int swap;
+  int i;
+
+  for (i = 0; i < BENCH_KEYS; i++)
+  {
+    total += 1.0 / pow(i + 1, s);
+    cdf[i] = total;
+
+    ranked[i] = keys[i];
+  }
+
+  for (i = BENCH_KEYS - 1; i > 0; i--)
+  {
+    mid = nextRandom(state) % (i + 1);
+
+    swap = ranked[i];
+    ranked[i] = ranked[mid];
+    ranked[mid] = swap;
+  }
+
+  for (i = 0; i < BENCH_QUERIES; i++)
+  {
+    u = (nextRandom(state) / 4294967296.0) * total;
+
+    lo = 0;
+    hi = BENCH_KEYS - 1;
+
+    while (lo < hi)
+    {
+      mid = (lo + hi) / 2;
+
+      if (cdf[mid] < u)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+
+    }
+
+    /* Odd values miss: one lookup in eight */
+    queries[i] = ranked[lo] + ((i & 7) == 0);
+  }
+
+  free(cdf);
+  free(ranked);
+}
+
+double timeLookups(int* keys, int* queries, int period, int* found)
+{
+  struct SplayTree tree;
+  clock_t start;
+  double seconds;
+  int i;
+
+  initSplay(&tree, period);
+  buildSplay(&tree, keys, BENCH_KEYS);
+
+  *found = 0;
+
+  start = clock();
+
+  for (i = 0; i < BENCH_QUERIES; i++)
+    *found += containsSplay(&tree, queries[i]);
+
+  seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+  freeSplay(&tree);
+
+  return seconds;
+}
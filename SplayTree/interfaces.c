@@ -0,0 +1,529 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+/* --------------------------------------------
+ *
+ *                  SPLAY TREE
+ *
+ * Foundation used:   Node (unbalanced, self-adjusting)
+ *
+ * Every splay brings the value searched for (or the last node on its
+ * search path) to the root, so recently used values sit near the top.
+ * Splaying is top-down: a single pass that dismantles the search path
+ * into a left and a right tree on the way down, with no recursion and
+ * no parent pointers. Operations are O(log₂(n)) amortized; the height
+ * itself is not bounded, so no traversal here uses a stack.
+ *
+ * --------------------------------------------
+ */
+
+void initSplay(struct SplayTree* tree, int period)
+{
+  /*  Description:
+   *    Function initializes a splay tree structure using a pointer to its memory address.
+   *    The function does not allocate additional memory upon initialization.
+   *
+   *  Parameters:
+   *    [struct] (SplayTree*) tree  : A pointer to the splay tree.
+   *    [int]                 period: " containsSplay() " splays on every period-th call, and
+   *                                  only searches otherwise; 1 splays on every call, 0 never.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - 'period' is not negative.
+   *
+   *  Post-conditions:
+   *    - The splay tree is initialized: the size is 0, and the root points to NULL.
+   */
+
+  assert(tree);
+  assert(period >= 0);
+
+  tree->root = NULL;
+  tree->size = 0;
+  tree->period = period;
+  tree->accesses = 0;
+}
+
+void freeSplay(struct SplayTree* tree)
+{
+  /*  Description:
+   *    Function frees every node without a stack: while the current node has a left child,
+   *    it is rotated right, so the left subtree is unrolled into a chain of right children.
+   *    A node with no left child is freed, and the traversal moves on to its right child.
+   *
+   *  Parameters:
+   *    [struct] (SplayTree*) tree: A pointer to the splay tree.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The splay tree is correctly linked.
+   *
+   *  Post-conditions:
+   *    - The splay tree's memory is freed, and it is empty.
+   */
+
+  struct SNode* curr;
+  struct SNode* left;
+
+  assert(tree);
+
+  curr = tree->root;
+
+  while (curr)
+  {
+
+    if (curr->left)
+    {
+      left = curr->left;
+
+      curr->left = left->right;
+      left->right = curr;
+
+      curr = left;
+    }
+    else
+    {
+      left = curr;
+      curr = curr->right;
+
+      free(left);
+    }
+
+  }
+
+  tree->root = NULL;
+  tree->size = 0;
+}
+
+int containsSplay(struct SplayTree* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)) amortized.
+   *    Function counts the access; on every period-th one, it splays the value to the root
+   *    and checks the root. Other accesses search without restructuring, so the tree is only
+   *    written to once every period calls, while hot values still drift towards the root.
+   *
+   *  Parameters:
+   *    [struct] (SplayTree*) tree: A pointer to the splay tree.
+   *    [TYPE]                val : The value to search for.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The splay tree is correctly linked.
+   *
+   *  Post-conditions:
+   *    - The function returns True (1) if the value is contained, or False (0) if not.
+   */
+
+  struct SNode* curr;
+
+  assert(tree);
+
+  tree->accesses++;
+
+  if ( tree->period > 0 && tree->accesses % tree->period == 0 )
+  {
+    tree->root = _splay(tree->root, val);
+
+    return tree->root && EQ(val, tree->root->val);
+  }
+
+  curr = tree->root;
+
+  while (curr)
+  {
+
+    if ( EQ(val, curr->val) )
+    {
+      return 1;
+    }
+    else if ( LT(val, curr->val) )
+    {
+      curr = curr->left;
+    }
+    else
+    {
+      curr = curr->right;
+    }
+
+  }
+
+  return 0;
+}
+
+int addSplay(struct SplayTree* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)) amortized.
+   *    Function splays the value's position to the root. If the root then holds the value, it
+   *    is already contained; otherwise, the new node becomes the root, taking the old root as
+   *    one child, and the old root's subtree on the other side of the value as the other.
+   *
+   *  Parameters:
+   *    [struct] (SplayTree*) tree: A pointer to the splay tree.
+   *    [TYPE]                val : The value to insert.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was added, False if it was already contained.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The splay tree is correctly linked.
+   *
+   *  Post-conditions:
+   *    - The value is contained exactly once, at the root.
+   */
+
+  struct SNode* node;
+
+  assert(tree);
+
+  tree->root = _splay(tree->root, val);
+
+  if ( tree->root && EQ(val, tree->root->val) )
+    return 0;
+
+  node = _newNode(val);
+
+  if (tree->root)
+  {
+
+    if ( LT(val, tree->root->val) )
+    {
+      node->left = tree->root->left;
+      node->right = tree->root;
+
+      tree->root->left = NULL;
+    }
+    else
+    {
+      node->right = tree->root->right;
+      node->left = tree->root;
+
+      tree->root->right = NULL;
+    }
+
+  }
+
+  tree->root = node;
+  tree->size++;
+
+  return 1;
+}
+
+int removeSplay(struct SplayTree* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)) amortized.
+   *    Function splays the value to the root. Its left subtree, all less than the value, is then
+   *    splayed for the value too, which brings its greatest node to its root with no right child;
+   *    the old root's right subtree is hung there, and the old root is freed.
+   *
+   *  Parameters:
+   *    [struct] (SplayTree*) tree: A pointer to the splay tree.
+   *    [TYPE]                val : The value to remove.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was removed, False if it was not contained.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *    - The splay tree is correctly linked.
+   *
+   *  Post-conditions:
+   *    - The value is not contained.
+   */
+
+  struct SNode* node;
+
+  assert(tree);
+
+  tree->root = _splay(tree->root, val);
+
+  if ( tree->root == NULL || !EQ(val, tree->root->val) )
+    return 0;
+
+  node = tree->root;
+
+  if (node->left)
+  {
+    tree->root = _splay(node->left, val);
+    tree->root->right = node->right;
+  }
+  else
+  {
+    tree->root = node->right;
+  }
+
+  free(node);
+
+  tree->size--;
+
+  return 1;
+}
+
+void buildSplay(struct SplayTree* tree, TYPE* vals, int n)
+{
+  /*  Description:
+   *    Complexity O(n).
+   *    Function replaces the splay tree's contents with a perfectly balanced tree of the given
+   *    values: each range of values still to place is kept on an explicit stack, with the child
+   *    pointer it hangs from, and the range's middle value is linked there.
+   *
+   *  Parameters:
+   *    [struct] (SplayTree*) tree: A pointer to the splay tree.
+   *    [TYPE]   (TYPE*)      vals: The values, sorted ascending with no repeats.
+   *    [int]                 n   : The number of values.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized splay tree.
+   *
+   *  Post-conditions:
+   *    - The splay tree holds exactly the given values, and its height is the least possible.
+   */
+
+  struct SNode** links[2 * SPLAY_MAX_HEIGHT];
+  int lo[2 * SPLAY_MAX_HEIGHT];
+  int hi[2 * SPLAY_MAX_HEIGHT];
+  struct SNode* node;
+  int top;
+  int mid;
+
+  assert(tree);
+  assert(vals || n == 0);
+
+  freeSplay(tree);
+
+  links[0] = &tree->root;
+  lo[0] = 0;
+  hi[0] = n;
+  top = 1;
+
+  while (top > 0)
+  {
+    top--;
+
+    if (lo[top] == hi[top])
+    {
+      *links[top] = NULL;
+
+      continue;
+    }
+
+    mid = lo[top] + (hi[top] - lo[top]) / 2;
+    node = _newNode(vals[mid]);
+
+    *links[top] = node;
+
+    links[top + 1] = &node->right;
+    lo[top + 1] = mid + 1;
+    hi[top + 1] = hi[top];
+
+    links[top] = &node->left;
+    hi[top] = mid;
+
+    top += 2;
+  }
+
+  tree->size = n;
+}
+
+void printSplay(struct SplayTree* tree)
+{
+  /*  Description:
+   *    Function prints the values in-order without a stack, by threading (Morris traversal):
+   *    before descending into a left subtree, its greatest node's NULL right pointer is pointed
+   *    back at the current node, and the thread is removed when it is followed.
+   *
+   *  Parameters:
+   *    [struct] (SplayTree*) tree: A pointer to the splay tree.
+   *
+   *  Pre-conditions:
+   *    - The splay tree is correctly linked.
+   *
+   *  Post-conditions:
+   *    - The values are printed to stdout in-order, and the tree is left as it was.
+   */
+
+  struct SNode* curr;
+  struct SNode* pred;
+
+  assert(tree);
+
+  curr = tree->root;
+
+  while (curr)
+  {
+
+    if (curr->left == NULL)
+    {
+      printf("Node with value: { %d }\n", curr->val);
+
+      curr = curr->right;
+
+      continue;
+    }
+
+    pred = curr->left;
+
+    while (pred->right && pred->right != curr)
+      pred = pred->right;
+
+    if (pred->right == NULL)
+    {
+      pred->right = curr;
+      curr = curr->left;
+    }
+    else
+    {
+      pred->right = NULL;
+
+      printf("Node with value: { %d }\n", curr->val);
+
+      curr = curr->right;
+    }
+
+  }
+
+}
+
+int isEmptySplay(struct SplayTree* tree)
+{
+  /*  Description:
+   *    Function checks the splay tree's size and returns true or false.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True or False, if the structure is empty or not.
+   */
+
+  assert(tree);
+
+  if (tree->size == 0)
+  {
+    return 1;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+struct SNode* _splay(struct SNode* curr, TYPE val)
+{
+  /*  Description:
+   *    Iterative auxiliary function.
+   *    Top-down splay. Walking down the search path, nodes passed on the way are split off:
+   *    those greater than the value are hung, in order, as left children down the right tree,
+   *    and those less than it as right children down the left tree. Two steps in the same
+   *    direction first rotate the pair (zig-zig), which is what halves the depth of the path.
+   *    The last node reached becomes the root, with the left and right trees as its subtrees.
+   *
+   *  Parameters:
+   *    [struct] (SNode*) curr: The root of the subtree to splay.
+   *    [TYPE]            val : The value to splay for.
+   *
+   *  Returns:
+   *    [struct]  (SNode*): The new root: the value's node if contained, else a neighbour of it.
+   */
+
+  struct SNode header;
+  struct SNode* left;
+  struct SNode* right;
+  struct SNode* next;
+
+  if (curr == NULL)
+    return NULL;
+
+  header.left = NULL;
+  header.right = NULL;
+
+  left = &header;
+  right = &header;
+
+  for (;;)
+  {
+
+    if ( LT(val, curr->val) )
+    {
+
+      if (curr->left == NULL)
+        break;
+
+      /* Zig-zig: rotate right first */
+      if ( LT(val, curr->left->val) )
+      {
+        next = curr->left;
+        curr->left = next->right;
+        next->right = curr;
+        curr = next;
+
+        if (curr->left == NULL)
+          break;
+
+      }
+
+      right->left = curr;
+      right = curr;
+      curr = curr->left;
+    }
+    else if ( LT(curr->val, val) )
+    {
+
+      if (curr->right == NULL)
+        break;
+
+      /* Zig-zig: rotate left first */
+      if ( LT(curr->right->val, val) )
+      {
+        next = curr->right;
+        curr->right = next->left;
+        next->left = curr;
+        curr = next;
+
+        if (curr->right == NULL)
+          break;
+
+      }
+
+      left->right = curr;
+      left = curr;
+      curr = curr->right;
+    }
+    else
+    {
+      break;
+    }
+
+  }
+
+  left->right = curr->left;
+  right->left = curr->right;
+
+  curr->left = header.right;
+  curr->right = header.left;
+
+  return curr;
+}
+
+struct SNode* _newNode(TYPE val)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Allocates a leaf with the given value.
+   */
+
+  struct SNode* node = (struct SNode*) malloc(sizeof(struct SNode));
+
+  assert(node);
+
+  node->left = NULL;
+  node->right = NULL;
+  node->val = val;
+
+  return node;
+}
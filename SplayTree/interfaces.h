@@ -0,0 +1,19 @@
+#include "structs.h"
+
+#ifndef __INTERFACES_H
+#define __INTERFACES_H
+
+/* Splay Tree */
+void initSplay(struct SplayTree* tree, int period);
+void freeSplay(struct SplayTree* tree);
+int containsSplay(struct SplayTree* tree, TYPE val);
+int addSplay(struct SplayTree* tree, TYPE val);
+int removeSplay(struct SplayTree* tree, TYPE val);
+void buildSplay(struct SplayTree* tree, TYPE* vals, int n);
+void printSplay(struct SplayTree* tree);
+int isEmptySplay(struct SplayTree* tree);
+struct SNode* _splay(struct SNode* curr, TYPE val);
+struct SNode* _newNode(TYPE val);
+/* END Splay Tree */
+
+#endif
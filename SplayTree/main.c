@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "structs.h"
+#include "interfaces.h"
+
+
+int main(int argc, char const *argv[])
+{
+  struct SplayTree splay;
+  FILE* file;
+  const char* fileName;
+  int quantity;
+  int val;
+
+  if (argc == 2)
+  {
+    fileName = argv[1];
+  }
+  else
+  {
+    fileName = "input.txt";
+  } 
+
+  file = fopen(fileName,"r");
+
+  printf("\n--------------------------------------------\n");
+
+  printf("\nHello! I'm here to generate simple visualizations of some basic data structures:\n");
+  printf("- Splay Tree\n\n");
+
+  printf("Press ENTER to continue.\n\n");
+  getchar();
+
+  /* --------------------------------------------
+   *
+   *                 SPLAY TREE
+   * 
+   * --------------------------------------------
+   */
+
+  quantity = 25;
+
+  printf("Here are some Splay Tree operations:\n\n");
+
+  initSplay(&splay, 1);
+
+  printf("- isEmpty: %d\n\n", isEmptySplay(&splay));
+
+  printf("- Adding values from %s...\n\n", fileName);
+
+  while ( !feof(file) && (quantity > 0) )
+  {
+    fscanf(file, "%d", &val);
+
+    addSplay(&splay, val);
+
+    quantity--;
+  }
+
+  printf("- isEmpty: %d\n\n", isEmptySplay(&splay));
+
+  printf("- contains {747}?: %d\n\n", containsSplay(&splay, 747));
+  printf("- contains {199}?: %d\n\n", containsSplay(&splay, 199));
+  printf("- contains {500}?: %d\n\n", containsSplay(&splay, 500));
+
+  printf("- Ready to print. Press ENTER.\n");
+  getchar();
+
+  printSplay(&splay);
+
+  printf("\n- root after contains {500}, a neighbour as it is absent: %d\n", splay.root->val);
+
+  printf("\n- add {199}: %d\n", addSplay(&splay, 199));
+  printf("- add {500}: %d\n", addSplay(&splay, 500));
+
+  printf("\n- root after add {500}: %d\n", splay.root->val);
+
+  printf("\n- removing {747}: %d\n", removeSplay(&splay, 747));
+  printf("- removing {747}: %d\n\n", removeSplay(&splay, 747));
+
+  printf("- contains {747}?: %d\n", containsSplay(&splay, 747));
+
+  printf("\n");
+
+  printf("- Freeing Splay Tree memory.\n");
+
+  freeSplay(&splay);
+
+  /* --------------------------------------------
+   *
+   *               END SPLAY TREE
+   * 
+   * --------------------------------------------
+   */
+
+  printf("\n--------------------------------------------\n");
+
+  fclose(file);
+  
+  return 0;
+}
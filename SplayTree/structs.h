@@ -0,0 +1,30 @@
+#ifndef __STRUCTS_H
+#define __STRUCTS_H
+
+# ifndef TYPE
+# define TYPE      int
+# define TYPE_SIZE sizeof(int)
+# define EQ(a,b) (a == b)
+# define LT(a,b) (a < b)
+# endif
+
+# define SPLAY_MAX_HEIGHT 64 /* Stack bound for buildSplay(), whose tree is perfectly balanced */
+
+struct SplayTree
+{
+  struct SNode* root;
+  int size;
+
+  int period;               /* containsSplay() splays every period-th call; 0 never, 1 always */
+  unsigned long accesses;
+};
+
+struct SNode
+{
+  struct SNode* left;
+  struct SNode* right;
+
+  TYPE val;
+};
+
+#endif
@@ -0,0 +1,714 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+/* --------------------------------------------
+ *
+ *               STRING-KEYED BST
+ *
+ * Foundation used:   Node (AVL-balanced, inline key prefix)
+ *
+ * An ordered map from strings to values. Every node keeps its key's
+ * first bytes packed into one integer, next to the child pointers, so
+ * most steps of a search are settled by a single integer comparison on
+ * the node itself; the key's remaining bytes are only read when two
+ * prefixes tie. Keys sharing a prefix are adjacent in-order, so the
+ * keys starting with a given string are found with one descent and
+ * walked from there.
+ *
+ * --------------------------------------------
+ */
+
+void initStrBST(struct StrBST* tree)
+{
+  /*  Description:
+   *    Function initializes a string-keyed BST structure using a pointer to its memory address.
+   *    The function does not allocate additional memory upon initialization.
+   *
+   *  Parameters:
+   *    [struct] (StrBST*) tree: A pointer to the string-keyed BST.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *
+   *  Post-conditions:
+   *    - The string-keyed BST is initialized: the size is 0, and the root points to NULL.
+   */
+
+  assert(tree);
+
+  tree->root = NULL;
+  tree->size = 0;
+}
+
+void freeStrBST(struct StrBST* tree)
+{
+  /*  Description:
+   *    Complexity O(n).
+   *    Function frees every node, with its key. Nodes are taken off an explicit stack, their
+   *    children stacked before they are freed; a balanced tree keeps the stack short.
+   *
+   *  Parameters:
+   *    [struct] (StrBST*) tree: A pointer to the string-keyed BST.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized string-keyed BST.
+   *
+   *  Post-conditions:
+   *    - All nodes are freed, and the string-keyed BST is empty.
+   */
+
+  struct StrNode* stack[STR_MAX_HEIGHT + 1];
+  struct StrNode* curr;
+  int top = 0;
+
+  assert(tree);
+
+  if (tree->root)
+    stack[top++] = tree->root;
+
+  while (top > 0)
+  {
+    curr = stack[--top];
+
+    if (curr->left)
+      stack[top++] = curr->left;
+
+    if (curr->right)
+      stack[top++] = curr->right;
+
+    free(curr);
+  }
+
+  initStrBST(tree);
+}
+
+int containsStrBST(struct StrBST* tree, const char* key)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)) comparisons, each reading the key's remaining bytes only on a prefix tie.
+   *    Function returns whether the key is contained.
+   *
+   *  Parameters:
+   *    [struct] (StrBST*) tree: A pointer to the string-keyed BST.
+   *    [char]   (char*)   key : The key to search for.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the key is contained, False otherwise.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized string-keyed BST.
+   *
+   *  Post-conditions:
+   *    - True (1) or False (0) is returned, accordingly.
+   */
+
+  if ( findStrBST(tree, key) )
+    return 1;
+  else
+    return 0;
+
+}
+
+struct StrNode* findStrBST(struct StrBST* tree, const char* key)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function searches for the key, packing its prefix once and comparing that integer
+   *    against each node's prefix on the way down.
+   *
+   *  Parameters:
+   *    [struct] (StrBST*) tree: A pointer to the string-keyed BST.
+   *    [char]   (char*)   key : The key to search for.
+   *
+   *  Returns:
+   *    [struct]  (StrNode*): The key's node, whose 'val' may be changed, or NULL if not contained.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized string-keyed BST.
+   *    - Pointer 'key' points to a NUL-terminated string.
+   */
+
+  struct StrNode* curr;
+  unsigned long prefix;
+  int length;
+  int cmp;
+
+  assert(tree);
+  assert(key);
+
+  length = (int) strlen(key);
+  prefix = _packPrefix(key, length);
+
+  curr = tree->root;
+
+  while (curr)
+  {
+    cmp = _compareKey(prefix, key, length, curr);
+
+    if (cmp == 0)
+      return curr;
+
+    if (cmp < 0)
+      curr = curr->left;
+    else
+      curr = curr->right;
+
+  }
+
+  return NULL;
+}
+
+int addStrBST(struct StrBST* tree, const char* key, ValueType val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function maps the key to the value. A key not yet contained gets a new leaf, holding
+   *    a copy of the key, and the path is re-balanced from the bottom up; a contained key has
+   *    its value replaced.
+   *
+   *  Parameters:
+   *    [struct] (StrBST*) tree: A pointer to the string-keyed BST.
+   *    [char]   (char*)   key : The key; copied, so the caller keeps ownership.
+   *    [ValueType]        val : The value to map it to.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the key was added, False if it was contained and its value replaced.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized string-keyed BST.
+   *    - Pointer 'key' points to a NUL-terminated string.
+   *
+   *  Post-conditions:
+   *    - The key is contained, mapped to the value.
+   */
+
+  struct StrNode** path[STR_MAX_HEIGHT];
+  struct StrNode** link;
+  unsigned long prefix;
+  int length;
+  int depth = 0;
+  int cmp;
+
+  assert(tree);
+  assert(key);
+
+  length = (int) strlen(key);
+  prefix = _packPrefix(key, length);
+
+  link = &tree->root;
+
+  while (*link)
+  {
+    cmp = _compareKey(prefix, key, length, *link);
+
+    if (cmp == 0)
+    {
+      (*link)->val = val;
+
+      return 0;
+    }
+
+    path[depth++] = link;
+
+    if (cmp < 0)
+      link = &(*link)->left;
+    else
+      link = &(*link)->right;
+
+  }
+
+  *link = _newNode(key, length, prefix, val);
+
+  tree->size++;
+
+  _retracePath(path, depth);
+
+  return 1;
+}
+
+int removeStrBST(struct StrBST* tree, const char* key)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function removes the key, if contained, as " removeBST() " does. A node's key is stored
+   *    with it, so a node with two children is not overwritten by its successor's key: the
+   *    successor is unlinked from the right subtree and linked in the node's place instead.
+   *
+   *  Parameters:
+   *    [struct] (StrBST*) tree: A pointer to the string-keyed BST.
+   *    [char]   (char*)   key : The key to remove.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the key was removed, False if it was not contained.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized string-keyed BST.
+   *    - Pointer 'key' points to a NUL-terminated string.
+   *
+   *  Post-conditions:
+   *    - The key is not contained, and its node is freed.
+   */
+
+  struct StrNode** path[STR_MAX_HEIGHT];
+  struct StrNode** link;
+  struct StrNode** succLink;
+  struct StrNode* node;
+  struct StrNode* succ;
+  unsigned long prefix;
+  int nodeDepth;
+  int length;
+  int depth = 0;
+  int cmp;
+
+  assert(tree);
+  assert(key);
+
+  length = (int) strlen(key);
+  prefix = _packPrefix(key, length);
+
+  link = &tree->root;
+
+  while (*link)
+  {
+    cmp = _compareKey(prefix, key, length, *link);
+
+    if (cmp == 0)
+      break;
+
+    path[depth++] = link;
+
+    if (cmp < 0)
+      link = &(*link)->left;
+    else
+      link = &(*link)->right;
+
+  }
+
+  node = *link;
+
+  if (node == NULL)
+    return 0;
+
+  if (node->right == NULL)
+  {
+    *link = node->left;
+  }
+  else
+  {
+    nodeDepth = depth;
+    path[depth++] = link;
+
+    succLink = &node->right;
+
+    while ( (*succLink)->left )
+    {
+      path[depth++] = succLink;
+
+      succLink = &(*succLink)->left;
+    }
+
+    succ = *succLink;
+    *succLink = succ->right;
+
+    succ->left = node->left;
+    succ->right = node->right;
+    succ->height = node->height;
+
+    /* The path ran through the node's right pointer, which is now the successor's */
+    if (depth > nodeDepth + 1)
+      path[nodeDepth + 1] = &succ->right;
+
+    *link = succ;
+  }
+
+  free(node);
+
+  tree->size--;
+
+  _retracePath(path, depth);
+
+  return 1;
+}
+
+void printStrBST(struct StrBST* tree)
+{
+  /*  Description:
+   *    Function prints the keys and their values in-order, walking with an explicit stack.
+   *
+   *  Parameters:
+   *    [struct] (StrBST*) tree: A pointer to the string-keyed BST.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized string-keyed BST.
+   *
+   *  Post-conditions:
+   *    - The keys and values are printed to stdout in-order.
+   */
+
+  struct StrNode* stack[STR_MAX_HEIGHT];
+  struct StrNode* curr;
+  int top = 0;
+
+  assert(tree);
+
+  curr = tree->root;
+
+  while (curr || top > 0)
+  {
+
+    while (curr)
+    {
+      stack[top++] = curr;
+      curr = curr->left;
+    }
+
+    curr = stack[--top];
+
+    printf("Node with key: { %s } & value: { %d }\n", curr->key, curr->val);
+
+    curr = curr->right;
+  }
+
+}
+
+int isEmptyStrBST(struct StrBST* tree)
+{
+  /*  Description:
+   *    Function returns whether the string-keyed BST is empty.
+   *
+   *  Parameters:
+   *    [struct] (StrBST*) tree: A pointer to the string-keyed BST.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the string-keyed BST is empty, False otherwise.
+   */
+
+  assert(tree);
+
+  if (tree->size == 0)
+    return 1;
+  else
+    return 0;
+
+}
+
+int prefixStrBST(struct StrBST* tree, const char* prefix,
+                 int (*visit)(const char* key, ValueType val, void* ctx), void* ctx)
+{
+  /*  Description:
+   *    Complexity O(log₂(n) + k), for k keys visited.
+   *    Function calls 'visit' on every key starting with the given prefix, in order, until
+   *    'visit' returns False (0): an autocomplete query takes the first few completions and
+   *    stops. The keys with a prefix are those from the prefix itself up to the first key
+   *    without it, so one descent finds the first, and an in-order walk on an explicit stack
+   *    goes on from there. A prefix no longer than the inline bytes is matched against each
+   *    node's packed prefix, under a mask, without reading the key.
+   *
+   *  Parameters:
+   *    [struct] (StrBST*)                    tree  : A pointer to the string-keyed BST.
+   *    [char]   (char*)                      prefix: The prefix; "" matches every key.
+   *    [int]    (*)(const char*, ValueType, void*) visit: Called on each key and its value, with
+   *                                                  'ctx'; returns True (1) to go on.
+   *    [void]   (void*)                      ctx   : Passed through to 'visit'.
+   *
+   *  Returns:
+   *    [int]     (count): The number of keys visited.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized string-keyed BST.
+   *    - 'visit' does not change the string-keyed BST.
+   */
+
+  struct StrNode* stack[STR_MAX_HEIGHT];
+  struct StrNode* curr;
+  unsigned long packed;
+  unsigned long mask;
+  int length;
+  int count = 0;
+  int top = 0;
+
+  assert(tree);
+  assert(prefix);
+  assert(visit);
+
+  length = (int) strlen(prefix);
+  packed = _packPrefix(prefix, length);
+
+  if (length == 0)
+    mask = 0;
+  else if (length < (int) STR_PREFIX_BYTES)
+    mask = ~0UL << (8 * (STR_PREFIX_BYTES - length));
+  else
+    mask = ~0UL;
+
+  /* Lower bound: stack every node not less than the prefix, on the way down */
+  curr = tree->root;
+
+  while (curr)
+  {
+
+    if (_compareKey(packed, prefix, length, curr) <= 0)
+    {
+      stack[top++] = curr;
+      curr = curr->left;
+    }
+    else
+    {
+      curr = curr->right;
+    }
+
+  }
+
+  while (top > 0)
+  {
+    curr = stack[--top];
+
+    if ( (curr->prefix & mask) != packed )
+      break;
+
+    if ( length > (int) STR_PREFIX_BYTES &&
+         ( curr->length < length ||
+           memcmp(curr->key + STR_PREFIX_BYTES, prefix + STR_PREFIX_BYTES, length - STR_PREFIX_BYTES) ) )
+      break;
+
+    count++;
+
+    if ( !visit(curr->key, curr->val, ctx) )
+      break;
+
+    for (curr = curr->right; curr; curr = curr->left)
+      stack[top++] = curr;
+
+  }
+
+  return count;
+}
+
+unsigned long _packPrefix(const char* key, int length)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Packs the key's first STR_PREFIX_BYTES bytes into an integer, most significant first,
+   *    padding a shorter key with zero bytes.
+   */
+
+  unsigned long prefix = 0;
+  int i;
+
+  for (i = 0; i < (int) STR_PREFIX_BYTES; i++)
+  {
+    prefix <<= 8;
+
+    if (i < length)
+      prefix |= (unsigned char) key[i];
+
+  }
+
+  return prefix;
+}
+
+int _compareKey(unsigned long prefix, const char* key, int length, struct StrNode* node)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Compares a key, given with its packed prefix and length, to the node's key, as strcmp()
+   *    would. Differing prefixes decide alone. Tied prefixes of keys shorter than the inline
+   *    bytes mean equal keys, since a shorter key's padding would differ; otherwise both keys
+   *    are at least that long, and only their remaining bytes are compared.
+   *
+   *  Returns:
+   *    [int]     (< 0 || 0 || > 0): The key is less than, equal to, or greater than the node's.
+   */
+
+  int shorter;
+  int cmp;
+
+  if (prefix != node->prefix)
+    return (prefix < node->prefix) ? -1 : 1;
+
+  if ( length < (int) STR_PREFIX_BYTES )
+    return 0;
+
+  shorter = (length < node->length) ? length : node->length;
+
+  cmp = memcmp(key + STR_PREFIX_BYTES, node->key + STR_PREFIX_BYTES, shorter - STR_PREFIX_BYTES);
+
+  if (cmp)
+    return cmp;
+
+  return length - node->length;
+}
+
+struct StrNode* _newNode(const char* key, int length, unsigned long prefix, ValueType val)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Allocates a leaf of height 1, with a copy of the key right after the node, so a node
+   *    and its key are one allocation.
+   */
+
+  struct StrNode* node = (struct StrNode*) malloc( sizeof(struct StrNode) + length + 1 );
+  assert(node);
+
+  node->left = NULL;
+  node->right = NULL;
+  node->prefix = prefix;
+  node->length = length;
+  node->height = 1;
+  node->key = (char*) (node + 1);
+  node->val = val;
+
+  memcpy(node->key, key, length + 1);
+
+  return node;
+}
+
+void _retracePath(struct StrNode** path[], int depth)
+{
+  /*  Description:
+   *    Iterative auxiliary function.
+   *    Walks a path of child pointers back up from the deepest one, re-balancing each subtree
+   *    in place. Once a subtree's height comes out unchanged, none of its ancestors can change.
+   *
+   *  Parameters:
+   *    [struct] (StrNode**[]) path : The child pointers from the root downwards.
+   *    [int]                  depth: The number of child pointers on the path.
+   *
+   *  Post-conditions:
+   *    - Every subtree on the path is AVL-balanced with correct heights.
+   */
+
+  int oldHeight;
+
+  while (depth > 0)
+  {
+    depth--;
+
+    oldHeight = (*path[depth])->height;
+
+    *path[depth] = _rebalance(*path[depth]);
+
+    if ( (*path[depth])->height == oldHeight )
+      break;
+
+  }
+
+}
+
+int _heightNode(struct StrNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns the stored height of the node, where a NULL pointer has height 0.
+   */
+
+  if (curr)
+  {
+    return curr->height;
+  }
+  else
+  {
+    return 0;
+  }
+
+}
+
+void _updateHeight(struct StrNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Recomputes the node's height from its children's.
+   */
+
+  int left = _heightNode(curr->left);
+  int right = _heightNode(curr->right);
+
+  curr->height = 1 + (left > right ? left : right);
+}
+
+struct StrNode* _rotateLeft(struct StrNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Rotates the subtree left: the right child becomes the subtree root,
+   *    and the current node becomes its left child.
+   *
+   *  Post-conditions:
+   *    - The new subtree root is returned, in-order sequence and heights are maintained.
+   */
+
+  struct StrNode* right = curr->right;
+
+  curr->right = right->left;
+  right->left = curr;
+
+  _updateHeight(curr);
+  _updateHeight(right);
+
+  return right;
+}
+
+struct StrNode* _rotateRight(struct StrNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Rotates the subtree right. Mirror of " _rotateLeft() ".
+   *
+   *  Post-conditions:
+   *    - The new subtree root is returned, in-order sequence and heights are maintained.
+   */
+
+  struct StrNode* left = curr->left;
+
+  curr->left = left->right;
+  left->right = curr;
+
+  _updateHeight(curr);
+  _updateHeight(left);
+
+  return left;
+}
+
+struct StrNode* _rebalance(struct StrNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Restores the AVL property at the current node, as in the BST.
+   *
+   *  Parameters:
+   *    [struct] (StrNode*) curr: A pointer to the subtree root to re-balance.
+   *
+   *  Post-conditions:
+   *    - The subtree's heights are updated, its height difference is at most 1,
+   *      and the new subtree root is returned.
+   */
+
+  int balance;
+
+  _updateHeight(curr);
+
+  balance = _heightNode(curr->left) - _heightNode(curr->right);
+
+  if (balance > 1)
+  {
+
+    if ( _heightNode(curr->left->left) < _heightNode(curr->left->right) )
+      curr->left = _rotateLeft(curr->left);
+
+    return _rotateRight(curr);
+  }
+  else if (balance < -1)
+  {
+
+    if ( _heightNode(curr->right->right) < _heightNode(curr->right->left) )
+      curr->right = _rotateRight(curr->right);
+
+    return _rotateLeft(curr);
+  }
+
+  return curr;
+}
@@ -0,0 +1,28 @@
+#include "structs.h"
+
+#ifndef __INTERFACES_H
+#define __INTERFACES_H
+
+/* String-keyed BST */
+void initStrBST(struct StrBST* tree);
+void freeStrBST(struct StrBST* tree);
+int containsStrBST(struct StrBST* tree, const char* key);
+struct StrNode* findStrBST(struct StrBST* tree, const char* key);
+int addStrBST(struct StrBST* tree, const char* key, ValueType val);
+int removeStrBST(struct StrBST* tree, const char* key);
+void printStrBST(struct StrBST* tree);
+int isEmptyStrBST(struct StrBST* tree);
+int prefixStrBST(struct StrBST* tree, const char* prefix,
+                 int (*visit)(const char* key, ValueType val, void* ctx), void* ctx);
+unsigned long _packPrefix(const char* key, int length);
+int _compareKey(unsigned long prefix, const char* key, int length, struct StrNode* node);
+struct StrNode* _newNode(const char* key, int length, unsigned long prefix, ValueType val);
+void _retracePath(struct StrNode** path[], int depth);
+int _heightNode(struct StrNode* curr);
+void _updateHeight(struct StrNode* curr);
+struct StrNode* _rotateLeft(struct StrNode* curr);
+struct StrNode* _rotateRight(struct StrNode* curr);
+struct StrNode* _rebalance(struct StrNode* curr);
+/* END String-keyed BST */
+
+#endif
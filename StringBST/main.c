@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+
+char* getWord(FILE *file); /* getWord function referenced from Professor Sinisa Todorovic */
+int printCompletion(const char* key, ValueType val, void* ctx);
+
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+int main(int argc, char const *argv[])
+{
+  struct StrBST tree;
+  struct StrNode* node;
+  FILE* file;
+
+  const char* fileName;
+  char* word;
+  int limit;
+
+  if (argc == 2)
+  {
+    fileName = argv[1];
+  }
+  else
+  {
+    fileName = "input.txt";
+  } 
+
+  file = fopen(fileName,"r");
+
+  printf("\n--------------------------------------------\n");
+
+  printf("\nHello! I'm here to generate simple visualizations of some basic data structures:\n");
+  printf("- String-keyed BST\n\n");
+
+  printf("Press ENTER to continue.\n\n");
+  getchar();
+
+  /* --------------------------------------------
+   *
+   *              STRING-KEYED BST
+   * 
+   * --------------------------------------------
+   */
+
+  printf("Here are some String-keyed BST operations:\n\n");
+
+  initStrBST(&tree);
+
+  printf("- isEmpty: %d\n\n", isEmptyStrBST(&tree));
+
+  printf("- Counting words from %s...\n\n", fileName);
+
+  do
+  {
+    word = getWord(file);
+
+    if (word)
+    {
+      node = findStrBST(&tree, word);
+
+      if (node)
+        node->val++;
+      else
+        addStrBST(&tree, word, 1);
+
+      free(word);
+    }
+
+  } while (word);
+
+  printf("- isEmpty: %d\n\n", isEmptyStrBST(&tree));
+
+  printf("- Ready to print. Press ENTER.\n");
+  getchar();
+
+  printStrBST(&tree);
+
+  printf("\n- Distinct words: %d\n\n", tree.size);
+
+  printf("- Contains key {\"the\"}?: %d\n", containsStrBST(&tree, "the"));
+  printf("- Count of {\"the\"}: %d\n\n", findStrBST(&tree, "the")->val);
+
+  limit = 5;
+
+  printf("- Completions of {\"th\"}, first %d: ", limit);
+
+  prefixStrBST(&tree, "th", printCompletion, &limit);
+
+  printf("\n- Completions of {\"light\"}: ");
+
+  printf("\n- %d found\n\n", prefixStrBST(&tree, "light", printCompletion, NULL));
+
+  printf("- Removing key {\"the\"}: %d\n", removeStrBST(&tree, "the"));
+  printf("- Removing key {\"the\"}: %d\n\n", removeStrBST(&tree, "the"));
+
+  printf("- Contains key {\"the\"}?: %d\n", containsStrBST(&tree, "the"));
+
+  printf("\n");
+
+  printf("- Freeing String-keyed BST memory.\n");
+
+  freeStrBST(&tree);
+
+  /* --------------------------------------------
+   *
+   *            END STRING-KEYED BST
+   * 
+   * --------------------------------------------
+   */
+
+  printf("\n--------------------------------------------\n");
+
+  fclose(file);
+  
+  return 0;
+}
+
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+char* getWord(FILE *file)
+{
+  
+  int length = 0;
+  int maxLength = 16;
+  char character;
+    
+  char* word = (char*)malloc(sizeof(char) * maxLength);
+  assert(word != NULL);
+    
+  while( (character = fgetc(file)) != EOF)
+  {
+    if((length+1) > maxLength)
+    {
+      maxLength *= 2;
+      word = (char*)realloc(word, maxLength);
+    }
+    if((character >= '0' && character <= '9') || /*is a number*/
+       (character >= 'A' && character <= 'Z') || /*or an uppercase letter*/
+       (character >= 'a' && character <= 'z') || /*or a lowercase letter*/
+       character == 39) /*or is an apostrophy*/
+    {
+      word[length] = character;
+      length++;
+    }
+    else if(length > 0)
+      break;
+  }
+    
+  if(length == 0)
+  {
+    free(word);
+    return NULL;
+  }
+  word[length] = '\0';
+  return word;
+}
+
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+int printCompletion(const char* key, ValueType val, void* ctx)
+{
+  int* limit = (int*) ctx;
+
+  printf("%s (%d) ", key, val);
+
+  if (limit == NULL)
+    return 1;
+
+  return --(*limit) > 0;
+}
@@ -0,0 +1,33 @@
+#ifndef __STRUCTS_H
+#define __STRUCTS_H
+
+# define KeyType   char*
+# define ValueType int
+
+# define STR_MAX_HEIGHT   64                    /* An AVL tree this tall needs more than 2^44 nodes */
+# define STR_PREFIX_BYTES sizeof(unsigned long) /* Key bytes held inline: 8 on 64-bit targets */
+
+struct StrBST
+{
+  struct StrNode* root;
+  int size;
+};
+
+/* The key's first STR_PREFIX_BYTES bytes are packed most significant first into 'prefix',
+ * zero-padded, so comparing two prefixes as integers orders them as strcmp() would.
+ * Only keys whose prefixes tie need their full bytes compared. The key itself is copied
+ * into the same allocation, right after the node. */
+struct StrNode
+{
+  struct StrNode* left;
+  struct StrNode* right;
+
+  unsigned long prefix;
+  int length;
+  int height;
+
+  KeyType   key;
+  ValueType val;
+};
+
+#endif
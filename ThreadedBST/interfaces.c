@@ -0,0 +1,795 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "structs.h"
+#include "interfaces.h"
+
+/* --------------------------------------------
+ *
+ *                 THREADED BST
+ *
+ * Foundation used:   Node (AVL-balanced, threaded)
+ *
+ * Every child pointer that would be NULL instead points at the in-order
+ * neighbour on its side, marked as a thread in its low bit. Stepping to
+ * the next or previous value then never needs a stack or a parent
+ * pointer: follow a thread, or descend one child and then the opposite
+ * spine, O(1) amortized over a whole scan. The tree also keeps its
+ * leftmost and rightmost nodes, so the minimum and maximum are O(1).
+ * Insertion and removal stay O(log₂(n)), re-balancing as in the BST.
+ *
+ * --------------------------------------------
+ */
+
+# define IS_THREAD(link) ( ((unsigned long) (link)) & TBST_THREAD )
+# define THREAD(node)    ( (struct TNode*) (((unsigned long) (node)) | TBST_THREAD) )
+# define UNTHREAD(link)  ( (struct TNode*) (((unsigned long) (link)) & ~TBST_THREAD) )
+
+void initTBST(struct TBST* tree)
+{
+  /*  Description:
+   *    Function initializes a threaded BST structure using a pointer to its memory address.
+   *    The function does not allocate additional memory upon initialization.
+   *
+   *  Parameters:
+   *    [struct] (TBST*) tree: A pointer to the threaded BST.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to a proper memory location.
+   *
+   *  Post-conditions:
+   *    - The threaded BST is initialized: the size is 0, and the root, min and max point to NULL.
+   */
+
+  assert(tree);
+
+  tree->root = NULL;
+  tree->min = NULL;
+  tree->max = NULL;
+  tree->size = 0;
+}
+
+void freeTBST(struct TBST* tree)
+{
+  /*  Description:
+   *    Complexity O(n).
+   *    Function frees every node in-order, by following the threads: a node's successor
+   *    never lies in the part of the tree already freed, so no stack is needed.
+   *
+   *  Parameters:
+   *    [struct] (TBST*) tree: A pointer to the threaded BST.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized threaded BST.
+   *
+   *  Post-conditions:
+   *    - All nodes are freed, and the threaded BST is empty.
+   */
+
+  struct TNode* curr;
+  struct TNode* next;
+
+  assert(tree);
+
+  curr = tree->min;
+
+  while (curr)
+  {
+    next = nextTBST(curr);
+
+    free(curr);
+
+    curr = next;
+  }
+
+  initTBST(tree);
+}
+
+int containsTBST(struct TBST* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function searches the threaded BST for the given value. A search ends on
+   *    reaching a thread, where a plain BST would reach NULL.
+   *
+   *  Parameters:
+   *    [struct] (TBST*) tree: A pointer to the threaded BST.
+   *    [TYPE]           val : The value to search for.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value is contained, False otherwise.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized threaded BST.
+   *
+   *  Post-conditions:
+   *    - True (1) or False (0) is returned, accordingly.
+   */
+
+  struct TNode* curr;
+
+  assert(tree);
+
+  curr = tree->root;
+
+  while ( curr && !IS_THREAD(curr) )
+  {
+
+    if ( EQ(val, curr->val) )
+      return 1;
+
+    if ( LT(val, curr->val) )
+      curr = curr->left;
+    else
+      curr = curr->right;
+
+  }
+
+  return 0;
+}
+
+int addTBST(struct TBST* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function adds the value, if not already contained. The new leaf takes over the thread
+   *    its parent had on that side, and threads back to its parent on the other side; then
+   *    the path is re-balanced from the bottom up.
+   *
+   *  Parameters:
+   *    [struct] (TBST*) tree: A pointer to the threaded BST.
+   *    [TYPE]           val : The value to add.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was added, False if it was already contained.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized threaded BST.
+   *
+   *  Post-conditions:
+   *    - The value is contained, and min and max are kept.
+   */
+
+  struct TNode** path[TBST_MAX_HEIGHT];
+  struct TNode** link;
+  struct TNode* curr;
+  struct TNode* node;
+  int depth = 0;
+
+  assert(tree);
+
+  if (tree->root == NULL)
+  {
+    node = _newNode(val, THREAD(NULL), THREAD(NULL));
+
+    tree->root = node;
+    tree->min = node;
+    tree->max = node;
+    tree->size++;
+
+    return 1;
+  }
+
+  link = &tree->root;
+
+  while (1)
+  {
+    curr = *link;
+
+    if ( EQ(val, curr->val) )
+      return 0;
+
+    path[depth++] = link;
+
+    if ( LT(val, curr->val) )
+    {
+
+      if ( IS_THREAD(curr->left) )
+      {
+        node = _newNode(val, curr->left, THREAD(curr));
+
+        curr->left = node;
+
+        if (curr == tree->min)
+          tree->min = node;
+
+        break;
+      }
+
+      link = &curr->left;
+    }
+    else
+    {
+
+      if ( IS_THREAD(curr->right) )
+      {
+        node = _newNode(val, THREAD(curr), curr->right);
+
+        curr->right = node;
+
+        if (curr == tree->max)
+          tree->max = node;
+
+        break;
+      }
+
+      link = &curr->right;
+    }
+
+  }
+
+  tree->size++;
+
+  _retracePath(path, depth);
+
+  return 1;
+}
+
+int removeTBST(struct TBST* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function removes the value, if contained. The node is unlinked as in the BST, and the
+   *    threads that pointed at it are redirected:
+   *
+   *    - No children     -> the parent's link becomes the node's own thread on that side.
+   *    - One child       -> the neighbour inside that child's subtree threads past the node.
+   *    - Two children    -> the successor (leftmost of the right subtree) takes the node's
+   *                         place, and the predecessor's thread is pointed at it.
+   *
+   *    Only the removed node moves out of the tree, so iterators at any other node stay valid.
+   *
+   *  Parameters:
+   *    [struct] (TBST*) tree: A pointer to the threaded BST.
+   *    [TYPE]           val : The value to remove.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the value was removed, False if it was not contained.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized threaded BST.
+   *
+   *  Post-conditions:
+   *    - The value is not contained, and min and max are kept.
+   */
+
+  struct TNode** path[TBST_MAX_HEIGHT];
+  struct TNode** link;
+  struct TNode* node;
+  struct TNode* next;
+  struct TNode* parent;
+  struct TNode* succ;
+  struct TNode* pred;
+  int nodeDepth;
+  int depth = 0;
+
+  assert(tree);
+
+  if (tree->root == NULL)
+    return 0;
+
+  link = &tree->root;
+
+  while ( !EQ(val, (*link)->val) )
+  {
+    path[depth++] = link;
+
+    next = LT(val, (*link)->val) ? (*link)->left : (*link)->right;
+
+    if ( IS_THREAD(next) )
+      return 0;
+
+    link = LT(val, (*link)->val) ? &(*link)->left : &(*link)->right;
+  }
+
+  node = *link;
+
+  /* The neighbours are reached through the node, so find them before unlinking it */
+  if (node == tree->min)
+    tree->min = nextTBST(node);
+
+  if (node == tree->max)
+    tree->max = prevTBST(node);
+
+  if ( IS_THREAD(node->left) && IS_THREAD(node->right) )
+  {
+
+    if (depth == 0)
+    {
+      tree->root = NULL;
+    }
+    else
+    {
+      parent = *path[depth - 1];
+
+      if (link == &parent->left)
+        *link = node->left;
+      else
+        *link = node->right;
+
+    }
+
+  }
+  else if ( IS_THREAD(node->right) )
+  {
+    pred = node->left;
+
+    while ( !IS_THREAD(pred->right) )
+      pred = pred->right;
+
+    pred->right = node->right;
+
+    *link = node->left;
+  }
+  else if ( IS_THREAD(node->left) )
+  {
+    succ = node->right;
+
+    while ( !IS_THREAD(succ->left) )
+      succ = succ->left;
+
+    succ->left = node->left;
+
+    *link = node->right;
+  }
+  else
+  {
+    pred = node->left;
+
+    while ( !IS_THREAD(pred->right) )
+      pred = pred->right;
+
+    nodeDepth = depth;
+    path[depth++] = link;
+
+    link = &node->right;
+    succ = node->right;
+
+    while ( !IS_THREAD(succ->left) )
+    {
+      path[depth++] = link;
+
+      link = &succ->left;
+      succ = succ->left;
+    }
+
+    if (link != &node->right)
+    {
+      /* Lift the successor out: its parent's left thread now points back at it */
+      if ( IS_THREAD(succ->right) )
+        *link = THREAD(succ);
+      else
+        *link = succ->right;
+
+      succ->right = node->right;
+
+      path[nodeDepth + 1] = &succ->right;
+    }
+
+    succ->left = node->left;
+    succ->height = node->height;
+
+    pred->right = THREAD(succ);
+
+    *path[nodeDepth] = succ;
+  }
+
+  free(node);
+
+  tree->size--;
+
+  _retracePath(path, depth);
+
+  return 1;
+}
+
+void printTBST(struct TBST* tree)
+{
+  /*  Description:
+   *    Function prints the values in-order, following the threads from the minimum.
+   *
+   *  Parameters:
+   *    [struct] (TBST*) tree: A pointer to the threaded BST.
+   *
+   *  Pre-conditions:
+   *    - Pointer 'tree' points to an initialized threaded BST.
+   *
+   *  Post-conditions:
+   *    - The values are printed to stdout in-order.
+   */
+
+  struct TNode* curr;
+
+  assert(tree);
+
+  for (curr = firstTBST(tree); curr; curr = nextTBST(curr))
+    printf("Node with value: { %d }\n", curr->val);
+
+}
+
+int isEmptyTBST(struct TBST* tree)
+{
+  /*  Description:
+   *    Function returns whether the threaded BST is empty.
+   *
+   *  Parameters:
+   *    [struct] (TBST*) tree: A pointer to the threaded BST.
+   *
+   *  Returns:
+   *    [int]     (1 || 0): True if the threaded BST is empty, False otherwise.
+   */
+
+  assert(tree);
+
+  if (tree->size == 0)
+    return 1;
+  else
+    return 0;
+
+}
+
+TYPE minTBST(struct TBST* tree)
+{
+  /*  Description:
+   *    Complexity O(1).
+   *    Function returns the least value, from the cached leftmost node.
+   *
+   *  Parameters:
+   *    [struct] (TBST*) tree: A pointer to the threaded BST.
+   *
+   *  Returns:
+   *    [TYPE]    (val): The least value.
+   *
+   *  Pre-conditions:
+   *    - The threaded BST is not empty.
+   */
+
+  assert(tree);
+  assert(tree->min);
+
+  return tree->min->val;
+}
+
+TYPE maxTBST(struct TBST* tree)
+{
+  /*  Description:
+   *    Complexity O(1).
+   *    Function returns the greatest value, from the cached rightmost node.
+   *
+   *  Parameters:
+   *    [struct] (TBST*) tree: A pointer to the threaded BST.
+   *
+   *  Returns:
+   *    [TYPE]    (val): The greatest value.
+   *
+   *  Pre-conditions:
+   *    - The threaded BST is not empty.
+   */
+
+  assert(tree);
+  assert(tree->max);
+
+  return tree->max->val;
+}
+
+TYPE popMinTBST(struct TBST* tree)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function removes and returns the least value. The new minimum is the old one's
+   *    successor, found by " removeTBST() " in O(1) amortized.
+   *
+   *  Parameters:
+   *    [struct] (TBST*) tree: A pointer to the threaded BST.
+   *
+   *  Returns:
+   *    [TYPE]    (val): The least value, no longer contained.
+   *
+   *  Pre-conditions:
+   *    - The threaded BST is not empty.
+   */
+
+  TYPE val = minTBST(tree);
+
+  removeTBST(tree, val);
+
+  return val;
+}
+
+struct TNode* firstTBST(struct TBST* tree)
+{
+  /*  Description:
+   *    Complexity O(1).
+   *    Function returns the iterator at the least value: its node, or NULL if the tree is empty.
+   *    Iterators are nodes, read through their 'val', and stay valid until their own value is
+   *    removed.
+   */
+
+  assert(tree);
+
+  return tree->min;
+}
+
+struct TNode* lastTBST(struct TBST* tree)
+{
+  /*  Description:
+   *    Complexity O(1).
+   *    Function returns the iterator at the greatest value, or NULL if the tree is empty.
+   */
+
+  assert(tree);
+
+  return tree->max;
+}
+
+struct TNode* seekTBST(struct TBST* tree, TYPE val)
+{
+  /*  Description:
+   *    Complexity O(log₂(n)).
+   *    Function returns the iterator at the least value not less than the given one, or NULL
+   *    if there is none: the start of an ordered scan from 'val'.
+   *
+   *  Parameters:
+   *    [struct] (TBST*) tree: A pointer to the threaded BST.
+   *    [TYPE]           val : The value to seek.
+   *
+   *  Returns:
+   *    [struct]  (TNode*): The first node whose value is not less than 'val', or NULL.
+   */
+
+  struct TNode* curr;
+  struct TNode* found = NULL;
+
+  assert(tree);
+
+  curr = tree->root;
+
+  while ( curr && !IS_THREAD(curr) )
+  {
+
+    if ( LT(curr->val, val) )
+    {
+      curr = curr->right;
+    }
+    else
+    {
+      found = curr;
+      curr = curr->left;
+    }
+
+  }
+
+  return found;
+}
+
+struct TNode* nextTBST(struct TNode* curr)
+{
+  /*  Description:
+   *    Complexity O(1) amortized.
+   *    Function steps an iterator to the next value: along the right thread, or else down
+   *    to the leftmost node of the right subtree. Over a full scan every link is crossed
+   *    at most twice.
+   *
+   *  Parameters:
+   *    [struct] (TNode*) curr: The iterator to step.
+   *
+   *  Returns:
+   *    [struct]  (TNode*): The node with the next value, or NULL past the greatest.
+   */
+
+  struct TNode* next;
+
+  assert(curr);
+
+  if ( IS_THREAD(curr->right) )
+    return UNTHREAD(curr->right);
+
+  next = curr->right;
+
+  while ( !IS_THREAD(next->left) )
+    next = next->left;
+
+  return next;
+}
+
+struct TNode* prevTBST(struct TNode* curr)
+{
+  /*  Description:
+   *    Complexity O(1) amortized.
+   *    Function steps an iterator to the previous value. Mirror of " nextTBST() ".
+   *
+   *  Parameters:
+   *    [struct] (TNode*) curr: The iterator to step.
+   *
+   *  Returns:
+   *    [struct]  (TNode*): The node with the previous value, or NULL before the least.
+   */
+
+  struct TNode* prev;
+
+  assert(curr);
+
+  if ( IS_THREAD(curr->left) )
+    return UNTHREAD(curr->left);
+
+  prev = curr->left;
+
+  while ( !IS_THREAD(prev->right) )
+    prev = prev->right;
+
+  return prev;
+}
+
+struct TNode* _newNode(TYPE val, struct TNode* left, struct TNode* right)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Allocates a leaf of height 1, whose links are the given threads.
+   */
+
+  struct TNode* node = (struct TNode*) malloc( sizeof(struct TNode) );
+  assert(node);
+  assert( !IS_THREAD(node) );
+
+  node->left = left;
+  node->right = right;
+  node->val = val;
+  node->height = 1;
+
+  return node;
+}
+
+void _retracePath(struct TNode** path[], int depth)
+{
+  /*  Description:
+   *    Iterative auxiliary function.
+   *    Walks a path of child pointers back up from the deepest one, re-balancing each subtree
+   *    in place. Once a subtree's height comes out unchanged, none of its ancestors can change.
+   *
+   *  Parameters:
+   *    [struct] (TNode**[]) path : The child pointers from the root downwards.
+   *    [int]                depth: The number of child pointers on the path.
+   *
+   *  Post-conditions:
+   *    - Every subtree on the path is AVL-balanced with correct heights.
+   */
+
+  int oldHeight;
+
+  while (depth > 0)
+  {
+    depth--;
+
+    oldHeight = (*path[depth])->height;
+
+    *path[depth] = _rebalance(*path[depth]);
+
+    if ( (*path[depth])->height == oldHeight )
+      break;
+
+  }
+
+}
+
+int _heightNode(struct TNode* link)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Returns the stored height of the child, where a thread has height 0.
+   */
+
+  if ( IS_THREAD(link) )
+  {
+    return 0;
+  }
+  else
+  {
+    return link->height;
+  }
+
+}
+
+void _updateHeight(struct TNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Recomputes the node's height from its children's.
+   */
+
+  int left = _heightNode(curr->left);
+  int right = _heightNode(curr->right);
+
+  curr->height = 1 + (left > right ? left : right);
+}
+
+struct TNode* _rotateLeft(struct TNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Rotates the subtree left, as in the BST. If the right child had no left subtree to
+   *    hand over, its left link was a thread back to the current node; the current node's
+   *    right link becomes a thread to the right child, its new successor.
+   *
+   *  Post-conditions:
+   *    - The new subtree root is returned, in-order sequence, threads and heights are maintained.
+   */
+
+  struct TNode* right = curr->right;
+
+  if ( IS_THREAD(right->left) )
+    curr->right = THREAD(right);
+  else
+    curr->right = right->left;
+
+  right->left = curr;
+
+  _updateHeight(curr);
+  _updateHeight(right);
+
+  return right;
+}
+
+struct TNode* _rotateRight(struct TNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Rotates the subtree right. Mirror of " _rotateLeft() ".
+   *
+   *  Post-conditions:
+   *    - The new subtree root is returned, in-order sequence, threads and heights are maintained.
+   */
+
+  struct TNode* left = curr->left;
+
+  if ( IS_THREAD(left->right) )
+    curr->left = THREAD(left);
+  else
+    curr->left = left->right;
+
+  left->right = curr;
+
+  _updateHeight(curr);
+  _updateHeight(left);
+
+  return left;
+}
+
+struct TNode* _rebalance(struct TNode* curr)
+{
+  /*  Description:
+   *    Auxiliary function.
+   *    Restores the AVL property at the current node, as in the BST.
+   *
+   *  Parameters:
+   *    [struct] (TNode*) curr: A pointer to the subtree root to re-balance.
+   *
+   *  Post-conditions:
+   *    - The subtree's heights are updated, its height difference is at most 1,
+   *      and the new subtree root is returned.
+   */
+
+  int balance;
+
+  _updateHeight(curr);
+
+  balance = _heightNode(curr->left) - _heightNode(curr->right);
+
+  if (balance > 1)
+  {
+
+    if ( _heightNode(curr->left->left) < _heightNode(curr->left->right) )
+      curr->left = _rotateLeft(curr->left);
+
+    return _rotateRight(curr);
+  }
+  else if (balance < -1)
+  {
+
+    if ( _heightNode(curr->right->right) < _heightNode(curr->right->left) )
+      curr->right = _rotateRight(curr->right);
+
+    return _rotateLeft(curr);
+  }
+
+  return curr;
+}
@@ -0,0 +1,34 @@
+#include "structs.h"
+
+#ifndef __INTERFACES_H
+#define __INTERFACES_H
+
+/* Threaded BST */
+void initTBST(struct TBST* tree);
+void freeTBST(struct TBST* tree);
+int containsTBST(struct TBST* tree, TYPE val);
+int addTBST(struct TBST* tree, TYPE val);
+int removeTBST(struct TBST* tree, TYPE val);
+void printTBST(struct TBST* tree);
+int isEmptyTBST(struct TBST* tree);
+
+TYPE minTBST(struct TBST* tree);
+TYPE maxTBST(struct TBST* tree);
+TYPE popMinTBST(struct TBST* tree);
+
+struct TNode* firstTBST(struct TBST* tree);
+struct TNode* lastTBST(struct TBST* tree);
+struct TNode* seekTBST(struct TBST* tree, TYPE val);
+struct TNode* nextTBST(struct TNode* curr);
+struct TNode* prevTBST(struct TNode* curr);
+
+struct TNode* _newNode(TYPE val, struct TNode* left, struct TNode* right);
+void _retracePath(struct TNode** path[], int depth);
+int _heightNode(struct TNode* link);
+void _updateHeight(struct TNode* curr);
+struct TNode* _rotateLeft(struct TNode* curr);
+struct TNode* _rotateRight(struct TNode* curr);
+struct TNode* _rebalance(struct TNode* curr);
+/* END Threaded BST */
+
+#endif
@@ -0,0 +1,110 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "structs.h"
+#include "interfaces.h"
+
+
+int main(int argc, char const *argv[])
+{
+  struct TBST tree;
+  struct TNode* iter;
+  FILE* file;
+  const char* fileName;
+  int quantity;
+  int val;
+
+  if (argc == 2)
+  {
+    fileName = argv[1];
+  }
+  else
+  {
+    fileName = "input.txt";
+  } 
+
+  file = fopen(fileName,"r");
+
+  printf("\n--------------------------------------------\n");
+
+  printf("\nHello! I'm here to generate simple visualizations of some basic data structures:\n");
+  printf("- Threaded BST\n\n");
+
+  printf("Press ENTER to continue.\n\n");
+  getchar();
+
+  /* --------------------------------------------
+   *
+   *                THREADED BST
+   * 
+   * --------------------------------------------
+   */
+
+  quantity = 25;
+
+  printf("Here are some Threaded BST operations:\n\n");
+
+  initTBST(&tree);
+
+  printf("- isEmpty: %d\n\n", isEmptyTBST(&tree));
+
+  printf("- Adding values from %s...\n\n", fileName);
+
+  while ( !feof(file) && (quantity > 0) )
+  {
+    fscanf(file, "%d", &val);
+
+    addTBST(&tree, val);
+
+    quantity--;
+  }
+
+  printf("- isEmpty: %d\n\n", isEmptyTBST(&tree));
+
+  printf("- contains {747}?: %d\n\n", containsTBST(&tree, 747));
+  printf("- contains {199}?: %d\n\n", containsTBST(&tree, 199));
+
+  printf("- min: %d, max: %d\n\n", minTBST(&tree), maxTBST(&tree));
+
+  printf("- Ready to print. Press ENTER.\n");
+  getchar();
+
+  printTBST(&tree);
+
+  printf("\n- scan from {450}, 5 values: ");
+
+  for (iter = seekTBST(&tree, 450), quantity = 5; iter && quantity > 0; iter = nextTBST(iter), quantity--)
+    printf("%d ", iter->val);
+
+  printf("\n- scan back from the max, 5 values: ");
+
+  for (iter = lastTBST(&tree), quantity = 5; iter && quantity > 0; iter = prevTBST(iter), quantity--)
+    printf("%d ", iter->val);
+
+  printf("\n\n- popMin: %d\n", popMinTBST(&tree));
+  printf("- popMin: %d\n", popMinTBST(&tree));
+  printf("- min: %d\n", minTBST(&tree));
+
+  printf("\n- removing {747}: %d\n", removeTBST(&tree, 747));
+  printf("- removing {747}: %d\n\n", removeTBST(&tree, 747));
+
+  printf("- contains {747}?: %d\n", containsTBST(&tree, 747));
+
+  printf("\n");
+
+  printf("- Freeing Threaded BST memory.\n");
+
+  freeTBST(&tree);
+
+  /* --------------------------------------------
+   *
+   *              END THREADED BST
+   * 
+   * --------------------------------------------
+   */
+
+  printf("\n--------------------------------------------\n");
+
+  fclose(file);
+  
+  return 0;
+}
@@ -0,0 +1,35 @@
+#ifndef __STRUCTS_H
+#define __STRUCTS_H
+
+# ifndef TYPE
+# define TYPE      int
+# define TYPE_SIZE sizeof(int)
+# define EQ(a,b) (a == b)
+# define LT(a,b) (a < b)
+# endif
+
+# define TBST_MAX_HEIGHT 64 /* An AVL tree this tall needs more than 2^44 nodes */
+
+# define TBST_THREAD 1UL    /* Low pointer bit: set on a link that is a thread, not a child */
+
+struct TBST
+{
+  struct TNode* root;
+  struct TNode* min;        /* Leftmost node, NULL when empty */
+  struct TNode* max;        /* Rightmost node, NULL when empty */
+  int size;
+};
+
+/* A NULL child is replaced by a thread to the in-order neighbour on that side, tagged
+ * with TBST_THREAD. The leftmost node's left and the rightmost node's right threads are
+ * tagged NULLs. Nodes come from malloc(), so the low bit of their address is always 0. */
+struct TNode
+{
+  struct TNode* left;       /* Left child, or thread to the predecessor */
+  struct TNode* right;      /* Right child, or thread to the successor */
+
+  TYPE val;
+  int height;
+};
+
+#endif